@@ -0,0 +1,140 @@
+/** ****************************************************************************
+ * @file CompactWire.cxx
+ * @brief Definition of channel signal object with 16-bit samples.
+ * @see  CompactWire.h
+ *
+ * ****************************************************************************/
+
+#include "lardataobj/RecoBase/CompactWire.h"
+
+// LArSoft libraries
+#include "lardataobj/Utilities/compact_float.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::fill()
+#include <cstdint>   // std::int16_t
+#include <stdexcept> // std::out_of_range, std::length_error
+#include <string>    // std::to_string()
+#include <utility>   // std::move()
+
+namespace recob {
+
+  //----------------------------------------------------------------------
+  CompactWire::CompactWire()
+    : fChannel(raw::InvalidChannelID)
+    , fView(geo::kUnknown)
+    , fNSignal(0)
+    , fEncoding(static_cast<unsigned char>(Encoding_t::Half))
+    , fSampleOffsets{0}
+  {}
+
+  //----------------------------------------------------------------------
+  CompactWire::CompactWire(RegionsOfInterest_t const& sigROIlist,
+                           raw::ChannelID_t channel,
+                           geo::View_t view,
+                           Encoding_t encoding /* = Encoding_t::Half */)
+    : fChannel(channel)
+    , fView(view)
+    , fNSignal(sigROIlist.size())
+    , fEncoding(static_cast<unsigned char>(encoding))
+  {
+    fRangeBegins.reserve(sigROIlist.n_ranges());
+    fSampleOffsets.reserve(sigROIlist.n_ranges() + 1);
+    fSamples.resize(sigROIlist.count());
+    if (encoding == Encoding_t::ScaledInt16) fScales.reserve(sigROIlist.n_ranges());
+
+    std::size_t offset = 0;
+    fSampleOffsets.push_back(offset);
+    for (auto const& range : sigROIlist.get_ranges()) {
+      std::span<float const> const values{range.data()};
+      std::span<std::uint16_t> const out{fSamples.data() + offset, values.size()};
+      switch (encoding) {
+      case Encoding_t::Half: lar::compact::encode_half(values, out); break;
+      case Encoding_t::BFloat16: lar::compact::encode_bfloat16(values, out); break;
+      case Encoding_t::ScaledInt16:
+        fScales.push_back(lar::compact::encode_scaled_int16(
+          values, {reinterpret_cast<std::int16_t*>(out.data()), out.size()}));
+        break;
+      } // switch
+      offset += values.size();
+      fRangeBegins.push_back(range.begin_index());
+      fSampleOffsets.push_back(offset);
+    } // for
+  } // CompactWire::CompactWire()
+
+  //----------------------------------------------------------------------
+  CompactWire::CompactWire(recob::Wire const& wire, Encoding_t encoding /* = Encoding_t::Half */)
+    : CompactWire(wire.SignalROI(), wire.Channel(), wire.View(), encoding)
+  {}
+
+  //----------------------------------------------------------------------
+  void CompactWire::FillRange(size_type i, std::span<float> out) const
+  {
+    if (i >= NRanges()) {
+      throw std::out_of_range("recob::CompactWire::FillRange(): region #" + std::to_string(i) +
+                              " out of range (" + std::to_string(NRanges()) + " regions)");
+    }
+    if (out.size() < RangeSize(i)) {
+      throw std::length_error("recob::CompactWire::FillRange(): buffer too small for region #" +
+                              std::to_string(i));
+    }
+    decodeRange(i, out.data());
+  } // CompactWire::FillRange()
+
+  //----------------------------------------------------------------------
+  std::vector<float> CompactWire::Signal() const
+  {
+    std::vector<float> signal(NSignal());
+    FillSignal(signal);
+    return signal;
+  } // CompactWire::Signal()
+
+  //----------------------------------------------------------------------
+  void CompactWire::FillSignal(std::span<float> out) const
+  {
+    if (out.size() < NSignal())
+      throw std::length_error("recob::CompactWire::FillSignal(): buffer too small for the signal");
+
+    size_type pos = 0;
+    for (size_type i = 0; i < NRanges(); ++i) {
+      std::fill(out.begin() + pos, out.begin() + RangeBegin(i), 0.0f);
+      decodeRange(i, out.data() + RangeBegin(i));
+      pos = RangeBegin(i) + RangeSize(i);
+    }
+    std::fill(out.begin() + pos, out.begin() + NSignal(), 0.0f);
+  } // CompactWire::FillSignal()
+
+  //----------------------------------------------------------------------
+  CompactWire::RegionsOfInterest_t CompactWire::SignalROI() const
+  {
+    RegionsOfInterest_t sigROIlist(NSignal());
+    for (size_type i = 0; i < NRanges(); ++i) {
+      RegionsOfInterest_t::vector_t values(RangeSize(i));
+      decodeRange(i, values.data());
+      sigROIlist.add_range(RangeBegin(i), std::move(values));
+    }
+    return sigROIlist;
+  } // CompactWire::SignalROI()
+
+  //----------------------------------------------------------------------
+  recob::Wire CompactWire::MakeWire() const
+  {
+    return {SignalROI(), Channel(), View()};
+  } // CompactWire::MakeWire()
+
+  //----------------------------------------------------------------------
+  void CompactWire::decodeRange(size_type i, float* out) const
+  {
+    std::span<std::uint16_t const> const values{fSamples.data() + fSampleOffsets[i], RangeSize(i)};
+    std::span<float> const dest{out, values.size()};
+    switch (Encoding()) {
+    case Encoding_t::Half: lar::compact::decode_half(values, dest); break;
+    case Encoding_t::BFloat16: lar::compact::decode_bfloat16(values, dest); break;
+    case Encoding_t::ScaledInt16:
+      lar::compact::decode_scaled_int16(
+        {reinterpret_cast<std::int16_t const*>(values.data()), values.size()}, fScales[i], dest);
+      break;
+    } // switch
+  } // CompactWire::decodeRange()
+
+} // namespace recob
@@ -0,0 +1,152 @@
+/** ****************************************************************************
+ * @file lardataobj/RecoBase/CompactWire.h
+ * @brief Declaration of channel signal object with 16-bit samples.
+ * @see  lardataobj/RecoBase/CompactWire.cxx
+ */
+
+#ifndef LARDATAOBJ_RECOBASE_COMPACTWIRE_H
+#define LARDATAOBJ_RECOBASE_COMPACTWIRE_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "lardataobj/RecoBase/Wire.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint16_t
+#include <span>
+#include <vector>
+
+namespace recob {
+
+  /**
+   * @brief Regions of interest of the signal from a channel, in 16 bits.
+   * @see `recob::Wire`, `lardataobj/Utilities/compact_float.h`
+   *
+   * This object holds the same information as a `recob::Wire`, with each
+   * sample of the regions of interest stored in 16 bits instead of a `float`,
+   * which halves the memory and storage needed by the signal.
+   * The precision of the samples depends on the chosen encoding:
+   *  * `Encoding_t::Half`: IEEE 754 half precision, with a relative precision
+   *    of about 0.05%; values beyond 65504 in magnitude are saturated to
+   *    infinity;
+   *  * `Encoding_t::BFloat16`: truncated single precision, with the full
+   *    `float` range and a relative precision of about 0.4%;
+   *  * `Encoding_t::ScaledInt16`: integers with a scale factor for each region
+   *    of interest, chosen so that the largest sample in the region has the
+   *    value `32767`; all samples of a region have the same absolute precision,
+   *    that is about 0.0015% of its largest sample.
+   *
+   * Samples are always returned as `float`.
+   * The content can be accessed region by region (`RangeBegin()`,
+   * `RangeSize()`, `FillRange()`), as a dense waveform (`Signal()`,
+   * `FillSignal()`), or converted back into a `recob::Wire` (`MakeWire()`).
+   */
+  class CompactWire {
+  public:
+    using RegionsOfInterest_t = recob::Wire::RegionsOfInterest_t;
+    using size_type = std::size_t;
+
+    /// Representation of the samples.
+    enum class Encoding_t : unsigned char {
+      Half,       ///< IEEE 754 half precision floating point.
+      BFloat16,   ///< `bfloat16` floating point.
+      ScaledInt16 ///< 16-bit integer with a scale factor for each region.
+    };
+
+    /// Default constructor: a channel with no signal information.
+    CompactWire();
+
+    /**
+       * @brief Constructor: encodes the specified regions of interest.
+       * @param sigROIlist signal organized in regions of interest
+       * @param channel the ID of the channel
+       * @param view the view the channel belongs to
+       * @param encoding the representation of the samples
+       *
+       * See `recob::Wire` constructors for the meaning of the arguments.
+       */
+    CompactWire(RegionsOfInterest_t const& sigROIlist,
+                raw::ChannelID_t channel,
+                geo::View_t view,
+                Encoding_t encoding = Encoding_t::Half);
+
+    /// Constructor: encodes the content of the specified wire.
+    explicit CompactWire(recob::Wire const& wire, Encoding_t encoding = Encoding_t::Half);
+
+    // --- BEGIN -- Accessors ------------------------------------------------
+    ///@name Accessors
+    ///@{
+
+    /// Returns the ID of the channel (or InvalidChannelID).
+    raw::ChannelID_t Channel() const { return fChannel; }
+
+    /// Returns the view the channel belongs to.
+    geo::View_t View() const { return fView; }
+
+    /// Returns the number of time ticks, or samples, in the channel.
+    size_type NSignal() const { return fNSignal; }
+
+    /// Returns the representation of the samples.
+    Encoding_t Encoding() const { return static_cast<Encoding_t>(fEncoding); }
+
+    /// Returns the number of regions of interest.
+    size_type NRanges() const { return fRangeBegins.size(); }
+
+    /// Returns the first tick of the region of interest `i` (no check).
+    size_type RangeBegin(size_type i) const { return fRangeBegins[i]; }
+
+    /// Returns the number of ticks of the region of interest `i` (no check).
+    size_type RangeSize(size_type i) const { return fSampleOffsets[i + 1] - fSampleOffsets[i]; }
+
+    /**
+       * @brief Writes the samples of region of interest `i` into `out`.
+       * @throw std::out_of_range if there is no region `i`
+       * @throw std::length_error if `out` is smaller than `RangeSize(i)`
+       */
+    void FillRange(size_type i, std::span<float> out) const;
+
+    /// Return a zero-padded full length vector filled with RoI signal.
+    std::vector<float> Signal() const;
+
+    /// Writes the zero-padded full signal into `out` (see `Wire::FillSignal()`).
+    /// @throw std::length_error if `out` is smaller than `NSignal()`
+    void FillSignal(std::span<float> out) const;
+
+    /// Returns a new sparse vector with the decoded regions of interest.
+    RegionsOfInterest_t SignalROI() const;
+
+    /// Returns a new `recob::Wire` with the decoded content of this channel.
+    recob::Wire MakeWire() const;
+
+    ///@}
+    // --- END -- Accessors --------------------------------------------------
+
+    /// Returns whether this channel ID is smaller than the other.
+    bool operator<(CompactWire const& than) const { return Channel() < than.Channel(); }
+
+  private:
+    raw::ChannelID_t fChannel; ///< ID of the associated channel.
+    geo::View_t fView;         ///< View corresponding to the plane of this wire.
+    unsigned int fNSignal;     ///< Number of ticks in the channel.
+    unsigned char fEncoding;   ///< Representation of the samples (`Encoding_t` value).
+
+    std::vector<unsigned int> fRangeBegins; ///< First tick of each region.
+
+    /// Index in `fSamples` of the first sample of each region; one extra entry.
+    std::vector<unsigned int> fSampleOffsets;
+
+    /// Scale of each region (only with `Encoding_t::ScaledInt16`).
+    std::vector<float> fScales;
+
+    std::vector<std::uint16_t> fSamples; ///< Encoded samples of all regions.
+
+    /// Decodes the samples of region `i` into `out` (no check).
+    void decodeRange(size_type i, float* out) const;
+
+  }; // class CompactWire
+
+} // namespace recob
+
+#endif // LARDATAOBJ_RECOBASE_COMPACTWIRE_H
@@ -0,0 +1,193 @@
+/** ****************************************************************************
+ * @file HitColumns.cxx
+ * @brief Definition of a columnar collection of hits.
+ * @see  HitColumns.h
+ *
+ * ****************************************************************************/
+
+#include "lardataobj/RecoBase/HitColumns.h"
+
+// C/C++ standard libraries
+#include <stdexcept> // std::out_of_range
+#include <string>    // std::to_string()
+
+namespace recob {
+
+  //----------------------------------------------------------------------
+  HitColumns::HitColumns(std::vector<recob::Hit> const& hits)
+  {
+    Reserve(hits.size());
+    for (recob::Hit const& hit : hits)
+      AddHit(hit);
+  } // HitColumns::HitColumns()
+
+  //----------------------------------------------------------------------
+  void HitColumns::Reserve(size_type nHits)
+  {
+    fChannels.reserve(nHits);
+    fStartTicks.reserve(nHits);
+    fEndTicks.reserve(nHits);
+    fPeakTimes.reserve(nHits);
+    fSigmaPeakTimes.reserve(nHits);
+    fRMSs.reserve(nHits);
+    fPeakAmplitudes.reserve(nHits);
+    fSigmaPeakAmplitudes.reserve(nHits);
+    fSummedADCs.reserve(nHits);
+    fIntegrals.reserve(nHits);
+    fSigmaIntegrals.reserve(nHits);
+    fMultiplicities.reserve(nHits);
+    fLocalIndices.reserve(nHits);
+    fGoodnessOfFits.reserve(nHits);
+    fNDFs.reserve(nHits);
+    fViews.reserve(nHits);
+    fSignalTypes.reserve(nHits);
+    fWireIDValid.reserve(nHits);
+    fCryostats.reserve(nHits);
+    fTPCs.reserve(nHits);
+    fPlanes.reserve(nHits);
+    fWires.reserve(nHits);
+  } // HitColumns::Reserve()
+
+  //----------------------------------------------------------------------
+  void HitColumns::AddHit(recob::Hit const& hit)
+  {
+    fChannels.push_back(hit.Channel());
+    fStartTicks.push_back(hit.StartTick());
+    fEndTicks.push_back(hit.EndTick());
+    fPeakTimes.push_back(hit.PeakTime());
+    fSigmaPeakTimes.push_back(hit.SigmaPeakTime());
+    fRMSs.push_back(hit.RMS());
+    fPeakAmplitudes.push_back(hit.PeakAmplitude());
+    fSigmaPeakAmplitudes.push_back(hit.SigmaPeakAmplitude());
+    fSummedADCs.push_back(hit.SummedADC());
+    fIntegrals.push_back(hit.Integral());
+    fSigmaIntegrals.push_back(hit.SigmaIntegral());
+    fMultiplicities.push_back(hit.Multiplicity());
+    fLocalIndices.push_back(hit.LocalIndex());
+    fGoodnessOfFits.push_back(hit.GoodnessOfFit());
+    fNDFs.push_back(hit.DegreesOfFreedom());
+    fViews.push_back(hit.View());
+    fSignalTypes.push_back(hit.SignalType());
+
+    geo::WireID const& wireID = hit.WireID();
+    fWireIDValid.push_back(wireID.isValid ? 1 : 0);
+    fCryostats.push_back(wireID.Cryostat);
+    fTPCs.push_back(wireID.TPC);
+    fPlanes.push_back(wireID.Plane);
+    fWires.push_back(wireID.Wire);
+  } // HitColumns::AddHit()
+
+  //----------------------------------------------------------------------
+  HitColumns::HitView HitColumns::at(size_type index) const
+  {
+    if (index >= size()) {
+      throw std::out_of_range("recob::HitColumns::at(): hit index " + std::to_string(index) +
+                              " out of range (" + std::to_string(size()) + " hits)");
+    }
+    return (*this)[index];
+  } // HitColumns::at()
+
+  //----------------------------------------------------------------------
+  std::vector<recob::Hit> HitColumns::ToHits() const
+  {
+    std::vector<recob::Hit> hits;
+    hits.reserve(size());
+    for (size_type i = 0; i < size(); ++i)
+      hits.push_back(MakeHit(i));
+    return hits;
+  } // HitColumns::ToHits()
+
+  //----------------------------------------------------------------------
+  HitColumns::HitIndices_t HitColumns::SelectTimeWindow(float startTime, float endTime) const
+  {
+    float const* times = fPeakTimes.data();
+    return selectIf([times, startTime, endTime](size_type i) {
+      return (times[i] >= startTime) & (times[i] < endTime);
+    });
+  } // HitColumns::SelectTimeWindow()
+
+  //----------------------------------------------------------------------
+  HitColumns::HitIndices_t HitColumns::SelectTimeWindow(float startTime,
+                                                        float endTime,
+                                                        HitIndices_t const& indices) const
+  {
+    float const* times = fPeakTimes.data();
+    return selectIf(
+      [times, startTime, endTime](size_type i) {
+        return (times[i] >= startTime) & (times[i] < endTime);
+      },
+      indices);
+  } // HitColumns::SelectTimeWindow(indices)
+
+  //----------------------------------------------------------------------
+  HitColumns::HitIndices_t HitColumns::SelectPlane(geo::PlaneID::PlaneID_t plane) const
+  {
+    auto const* planes = fPlanes.data();
+    auto const* valid = fWireIDValid.data();
+    return selectIf(
+      [planes, valid, plane](size_type i) { return (valid[i] != 0) & (planes[i] == plane); });
+  } // HitColumns::SelectPlane()
+
+  //----------------------------------------------------------------------
+  HitColumns::HitIndices_t HitColumns::SelectPlane(geo::PlaneID::PlaneID_t plane,
+                                                   HitIndices_t const& indices) const
+  {
+    auto const* planes = fPlanes.data();
+    auto const* valid = fWireIDValid.data();
+    return selectIf(
+      [planes, valid, plane](size_type i) { return (valid[i] != 0) & (planes[i] == plane); },
+      indices);
+  } // HitColumns::SelectPlane(indices)
+
+  //----------------------------------------------------------------------
+  HitColumns::HitIndices_t HitColumns::SelectAmplitude(float min) const
+  {
+    float const* amplitudes = fPeakAmplitudes.data();
+    return selectIf([amplitudes, min](size_type i) { return amplitudes[i] >= min; });
+  } // HitColumns::SelectAmplitude()
+
+  //----------------------------------------------------------------------
+  HitColumns::HitIndices_t HitColumns::SelectAmplitude(float min,
+                                                       HitIndices_t const& indices) const
+  {
+    float const* amplitudes = fPeakAmplitudes.data();
+    return selectIf([amplitudes, min](size_type i) { return amplitudes[i] >= min; }, indices);
+  } // HitColumns::SelectAmplitude(indices)
+
+  //----------------------------------------------------------------------
+  //--- HitColumns::HitView
+  //----------------------------------------------------------------------
+  geo::WireID HitColumns::HitView::WireID() const
+  {
+    geo::WireID wireID{fHits->fCryostats[fIndex],
+                       fHits->fTPCs[fIndex],
+                       fHits->fPlanes[fIndex],
+                       fHits->fWires[fIndex]};
+    wireID.setValidity(fHits->fWireIDValid[fIndex] != 0);
+    return wireID;
+  } // HitColumns::HitView::WireID()
+
+  //----------------------------------------------------------------------
+  recob::Hit HitColumns::HitView::MakeHit() const
+  {
+    return {Channel(),
+            StartTick(),
+            EndTick(),
+            PeakTime(),
+            SigmaPeakTime(),
+            RMS(),
+            PeakAmplitude(),
+            SigmaPeakAmplitude(),
+            SummedADC(),
+            Integral(),
+            SigmaIntegral(),
+            Multiplicity(),
+            LocalIndex(),
+            GoodnessOfFit(),
+            DegreesOfFreedom(),
+            View(),
+            SignalType(),
+            WireID()};
+  } // HitColumns::HitView::MakeHit()
+
+} // namespace recob
@@ -0,0 +1,302 @@
+/** ****************************************************************************
+ * @file lardataobj/RecoBase/HitColumns.h
+ * @brief Declaration of a columnar collection of hits.
+ * @see  lardataobj/RecoBase/HitColumns.cxx
+ */
+
+#ifndef LARDATAOBJ_RECOBASE_HITCOLUMNS_H
+#define LARDATAOBJ_RECOBASE_HITCOLUMNS_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t, raw::TDCtick_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "lardataobj/RecoBase/Hit.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <span>
+#include <vector>
+
+namespace recob {
+
+  /**
+   * @brief Collection of hits stored by column.
+   * @see `recob::Hit`
+   *
+   * This object holds the same information as a collection of `recob::Hit`,
+   * with each data member of the hit stored in its own array (the wire ID is
+   * split in cryostat, TPC, plane and wire numbers).
+   * Loops reading only a few of the hit quantities, like peak time, plane and
+   * integral, then read contiguous memory and only the data they need.
+   *
+   * The content of a single hit is accessed via a `HitView` object, which
+   * offers the same accessors as `recob::Hit`:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * recob::HitColumns const hits{hitVector};
+   * for (std::size_t iHit: hits.SelectTimeWindow(t0, t1)) {
+   *   recob::HitColumns::HitView const hit = hits[iHit];
+   *   if (hit.WireID().Plane != 2) continue;
+   *   charge += hit.Integral();
+   * }
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * The selection methods (`SelectTimeWindow()`, `SelectPlane()`,
+   * `SelectAmplitude()`) return the indices of the hits passing the cut, in
+   * increasing order; each has an overload restricting the selection to a
+   * list of indices, so that cuts can be chained.
+   * Hits are kept in the order they were added, so the indices are the same
+   * as in the original collection.
+   *
+   * Conversion from and to `recob::Hit` collections is provided by the
+   * constructor and by `ToHits()` respectively.
+   */
+  class HitColumns {
+  public:
+    using size_type = std::size_t;
+
+    /// Type of list of hit indices.
+    using HitIndices_t = std::vector<size_type>;
+
+    class HitView;
+
+    /// Default constructor: no hits.
+    HitColumns() = default;
+
+    /// Constructor: copies the content of the specified hits, in order.
+    explicit HitColumns(std::vector<recob::Hit> const& hits);
+
+    // --- BEGIN -- Filling --------------------------------------------------
+    /// @name Filling
+    /// @{
+
+    /// Prepares memory for the specified number of hits.
+    void Reserve(size_type nHits);
+
+    /// Appends a hit.
+    void AddHit(recob::Hit const& hit);
+
+    /// @}
+    // --- END -- Filling ----------------------------------------------------
+
+    // --- BEGIN -- Accessors ------------------------------------------------
+    /// @name Accessors
+    /// @{
+
+    /// Returns the number of hits.
+    size_type size() const { return fChannels.size(); }
+
+    /// Returns whether there are no hits.
+    bool empty() const { return fChannels.empty(); }
+
+    /// Returns the view of the hit with the specified index (no check).
+    HitView operator[](size_type index) const;
+
+    /// Returns the view of the hit with the specified index.
+    /// @throw std::out_of_range if `index` is not smaller than `size()`
+    HitView at(size_type index) const;
+
+    /// Returns a new `recob::Hit` with the content of the specified hit.
+    recob::Hit MakeHit(size_type index) const;
+
+    /// Returns the content as a collection of `recob::Hit`, in order.
+    std::vector<recob::Hit> ToHits() const;
+
+    /// @}
+    // --- END -- Accessors --------------------------------------------------
+
+    // --- BEGIN -- Columns --------------------------------------------------
+    /// @name Columns
+    /// Each column has one entry per hit, in the order of the hits.
+    /// @{
+
+    std::span<raw::ChannelID_t const> Channels() const { return fChannels; }
+    std::span<raw::TDCtick_t const> StartTicks() const { return fStartTicks; }
+    std::span<raw::TDCtick_t const> EndTicks() const { return fEndTicks; }
+    std::span<float const> PeakTimes() const { return fPeakTimes; }
+    std::span<float const> SigmaPeakTimes() const { return fSigmaPeakTimes; }
+    std::span<float const> RMSs() const { return fRMSs; }
+    std::span<float const> PeakAmplitudes() const { return fPeakAmplitudes; }
+    std::span<float const> SigmaPeakAmplitudes() const { return fSigmaPeakAmplitudes; }
+    std::span<float const> SummedADCs() const { return fSummedADCs; }
+    std::span<float const> Integrals() const { return fIntegrals; }
+    std::span<float const> SigmaIntegrals() const { return fSigmaIntegrals; }
+    std::span<short int const> Multiplicities() const { return fMultiplicities; }
+    std::span<short int const> LocalIndices() const { return fLocalIndices; }
+    std::span<float const> GoodnessOfFits() const { return fGoodnessOfFits; }
+    std::span<int const> DegreesOfFreedom() const { return fNDFs; }
+    std::span<geo::View_t const> Views() const { return fViews; }
+    std::span<geo::SigType_t const> SignalTypes() const { return fSignalTypes; }
+    std::span<geo::CryostatID::CryostatID_t const> Cryostats() const { return fCryostats; }
+    std::span<geo::TPCID::TPCID_t const> TPCs() const { return fTPCs; }
+    std::span<geo::PlaneID::PlaneID_t const> Planes() const { return fPlanes; }
+    std::span<geo::WireID::WireID_t const> Wires() const { return fWires; }
+
+    /// @}
+    // --- END -- Columns ----------------------------------------------------
+
+    // --- BEGIN -- Selection ------------------------------------------------
+    /// @name Selection
+    /// @{
+
+    /// Returns the indices of hits with peak time in `[startTime, endTime[`.
+    HitIndices_t SelectTimeWindow(float startTime, float endTime) const;
+
+    /// Returns the hits in `indices` with peak time in `[startTime, endTime[`.
+    HitIndices_t SelectTimeWindow(float startTime,
+                                  float endTime,
+                                  HitIndices_t const& indices) const;
+
+    /// Returns the indices of hits on the specified plane number.
+    HitIndices_t SelectPlane(geo::PlaneID::PlaneID_t plane) const;
+
+    /// Returns the hits in `indices` on the specified plane number.
+    HitIndices_t SelectPlane(geo::PlaneID::PlaneID_t plane, HitIndices_t const& indices) const;
+
+    /// Returns the indices of hits with peak amplitude not smaller than `min`.
+    HitIndices_t SelectAmplitude(float min) const;
+
+    /// Returns the hits in `indices` with peak amplitude not smaller than `min`.
+    HitIndices_t SelectAmplitude(float min, HitIndices_t const& indices) const;
+
+    /// @}
+    // --- END -- Selection --------------------------------------------------
+
+  private:
+    std::vector<raw::ChannelID_t> fChannels;               ///< Readout channel of each hit.
+    std::vector<raw::TDCtick_t> fStartTicks;               ///< Initial TDC tick of each hit.
+    std::vector<raw::TDCtick_t> fEndTicks;                 ///< Final TDC tick of each hit.
+    std::vector<float> fPeakTimes;                         ///< Peak time of each hit [tick].
+    std::vector<float> fSigmaPeakTimes;                    ///< Peak time uncertainty [tick].
+    std::vector<float> fRMSs;                              ///< RMS of each hit shape [tick].
+    std::vector<float> fPeakAmplitudes;                    ///< Peak amplitude of each hit [ADC].
+    std::vector<float> fSigmaPeakAmplitudes;               ///< Peak amplitude uncertainty [ADC].
+    std::vector<float> fSummedADCs;                        ///< Sum of the ADC counts of each hit.
+    std::vector<float> fIntegrals;                         ///< Integral of each hit [tick x ADC].
+    std::vector<float> fSigmaIntegrals;                    ///< Integral uncertainty of each hit.
+    std::vector<short int> fMultiplicities;                ///< Multiplicity of each hit.
+    std::vector<short int> fLocalIndices;                  ///< Local index of each hit.
+    std::vector<float> fGoodnessOfFits;                    ///< Goodness of fit of each hit.
+    std::vector<int> fNDFs;                                ///< Degrees of freedom of each hit.
+    std::vector<geo::View_t> fViews;                       ///< View of each hit.
+    std::vector<geo::SigType_t> fSignalTypes;              ///< Signal type of each hit.
+    std::vector<unsigned char> fWireIDValid;               ///< Whether each wire ID is valid.
+    std::vector<geo::CryostatID::CryostatID_t> fCryostats; ///< Cryostat of each hit.
+    std::vector<geo::TPCID::TPCID_t> fTPCs;                ///< TPC of each hit.
+    std::vector<geo::PlaneID::PlaneID_t> fPlanes;          ///< Plane of each hit.
+    std::vector<geo::WireID::WireID_t> fWires;             ///< Wire of each hit.
+
+    /// Returns the indices `i` in `[0, size()[` for which `pass(i)` is true.
+    template <typename Pred>
+    HitIndices_t selectIf(Pred pass) const;
+
+    /// Returns the indices `i` in `indices` for which `pass(i)` is true.
+    template <typename Pred>
+    HitIndices_t selectIf(Pred pass, HitIndices_t const& indices) const;
+
+  }; // class HitColumns
+
+  //----------------------------------------------------------------------------
+  /**
+   * @brief Read-only view of a hit in a `recob::HitColumns`.
+   *
+   * The view supports the accessors of `recob::Hit`.
+   * A `recob::Hit` with the same content is returned by `MakeHit()`.
+   *
+   * The view is invalidated when the `HitColumns` it refers to is changed or
+   * destroyed.
+   */
+  class HitColumns::HitView {
+  public:
+    HitView(HitColumns const& hits, size_type index) : fHits(&hits), fIndex(index) {}
+
+    /// Returns the index of the hit in the collection.
+    size_type Index() const { return fIndex; }
+
+    raw::TDCtick_t StartTick() const { return fHits->fStartTicks[fIndex]; }
+    raw::TDCtick_t EndTick() const { return fHits->fEndTicks[fIndex]; }
+    float PeakTime() const { return fHits->fPeakTimes[fIndex]; }
+    float SigmaPeakTime() const { return fHits->fSigmaPeakTimes[fIndex]; }
+    float RMS() const { return fHits->fRMSs[fIndex]; }
+    float PeakAmplitude() const { return fHits->fPeakAmplitudes[fIndex]; }
+    float SigmaPeakAmplitude() const { return fHits->fSigmaPeakAmplitudes[fIndex]; }
+    float SummedADC() const { return fHits->fSummedADCs[fIndex]; }
+    float Integral() const { return fHits->fIntegrals[fIndex]; }
+    float SigmaIntegral() const { return fHits->fSigmaIntegrals[fIndex]; }
+    short int Multiplicity() const { return fHits->fMultiplicities[fIndex]; }
+    short int LocalIndex() const { return fHits->fLocalIndices[fIndex]; }
+    float GoodnessOfFit() const { return fHits->fGoodnessOfFits[fIndex]; }
+    int DegreesOfFreedom() const { return fHits->fNDFs[fIndex]; }
+    raw::ChannelID_t Channel() const { return fHits->fChannels[fIndex]; }
+    geo::View_t View() const { return fHits->fViews[fIndex]; }
+    geo::SigType_t SignalType() const { return fHits->fSignalTypes[fIndex]; }
+
+    /// Returns the ID of the wire the hit is on (a copy, assembled on demand).
+    geo::WireID WireID() const;
+
+    /// Returns `PeakTime() + sigmas x RMS()` (see `recob::Hit`).
+    float PeakTimePlusRMS(float sigmas = +1.) const { return PeakTime() + sigmas * RMS(); }
+
+    /// Returns `PeakTime() - sigmas x RMS()` (see `recob::Hit`).
+    float PeakTimeMinusRMS(float sigmas = +1.) const { return PeakTimePlusRMS(-sigmas); }
+
+    /// Returns the distance of `time` from the peak, in RMS units (no check!).
+    float TimeDistanceAsRMS(float time) const { return (time - PeakTime()) / RMS(); }
+
+    /// Returns a new `recob::Hit` with the content of this hit.
+    recob::Hit MakeHit() const;
+
+  private:
+    HitColumns const* fHits; ///< The collection this view refers to.
+    size_type fIndex;        ///< Index of the hit in the collection.
+
+  }; // class HitColumns::HitView
+
+} // namespace recob
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline recob::HitColumns::HitView recob::HitColumns::operator[](size_type index) const
+{
+  return {*this, index};
+}
+
+inline recob::Hit recob::HitColumns::MakeHit(size_type index) const
+{
+  return (*this)[index].MakeHit();
+}
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Pred>
+recob::HitColumns::HitIndices_t recob::HitColumns::selectIf(Pred pass) const
+{
+  // branchless compaction: every index is written, only passing ones are kept
+  HitIndices_t selected(size());
+  size_type n = 0;
+  for (size_type i = 0; i < size(); ++i) {
+    selected[n] = i;
+    n += pass(i) ? 1 : 0;
+  }
+  selected.resize(n);
+  return selected;
+} // recob::HitColumns::selectIf()
+
+//------------------------------------------------------------------------------
+template <typename Pred>
+recob::HitColumns::HitIndices_t recob::HitColumns::selectIf(Pred pass,
+                                                            HitIndices_t const& indices) const
+{
+  HitIndices_t selected(indices.size());
+  size_type n = 0;
+  for (size_type const i : indices) {
+    selected[n] = i;
+    n += pass(i) ? 1 : 0;
+  }
+  selected.resize(n);
+  return selected;
+} // recob::HitColumns::selectIf(indices)
+
+//------------------------------------------------------------------------------
+
+#endif // LARDATAOBJ_RECOBASE_HITCOLUMNS_H
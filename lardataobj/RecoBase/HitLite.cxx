@@ -0,0 +1,117 @@
+/** ****************************************************************************
+ * @file HitLite.cxx
+ * @brief Definition of a compact signal hit object.
+ * @see  HitLite.h
+ *
+ * ****************************************************************************/
+
+#include "lardataobj/RecoBase/HitLite.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::clamp()
+#include <cmath>     // std::floor(), std::log2(), std::exp2()
+
+namespace {
+
+  /// Number of codes per factor 2 in the uncertainty quantization.
+  constexpr float SigmaCodesPerOctave = 10.0f;
+
+  /// Power of 2 of the lower edge of the smallest positive uncertainty code.
+  constexpr float SigmaMinExponent = -10.0f;
+
+  /// Code of negative (unknown) uncertainties.
+  constexpr unsigned int SigmaUnknownCode = 0;
+
+  /// Code of null uncertainties.
+  constexpr unsigned int SigmaZeroCode = 1;
+
+  /// First code of positive uncertainties.
+  constexpr unsigned int SigmaFirstCode = 2;
+
+} // local namespace
+
+namespace recob {
+
+  //----------------------------------------------------------------------
+  HitLite::HitLite()
+    : fChannel(raw::InvalidChannelID)
+    , fStartTick(0)
+    , fEndTick(0)
+    , fPeakTime(0.)
+    , fRMS(0.)
+    , fPeakAmplitude(0.)
+    , fSummedADC(0.)
+    , fIntegral(0.)
+    , fMultiplicity(0)
+    , fLocalIndex(-1)
+    , fSigmaPeakTimeCode(SigmaUnknownCode)
+    , fSigmaPeakAmplitudeCode(SigmaUnknownCode)
+    , fSigmaIntegralCode(SigmaUnknownCode)
+  {}
+
+  //----------------------------------------------------------------------
+  HitLite::HitLite(recob::Hit const& hit)
+    : fChannel(hit.Channel())
+    , fStartTick(hit.StartTick())
+    , fEndTick(hit.EndTick())
+    , fPeakTime(hit.PeakTime())
+    , fRMS(hit.RMS())
+    , fPeakAmplitude(hit.PeakAmplitude())
+    , fSummedADC(hit.SummedADC())
+    , fIntegral(hit.Integral())
+    , fMultiplicity(hit.Multiplicity())
+    , fLocalIndex(hit.LocalIndex())
+    , fSigmaPeakTimeCode(encodeSigma(hit.SigmaPeakTime()))
+    , fSigmaPeakAmplitudeCode(encodeSigma(hit.SigmaPeakAmplitude()))
+    , fSigmaIntegralCode(encodeSigma(hit.SigmaIntegral()))
+  {}
+
+  //----------------------------------------------------------------------
+  recob::Hit HitLite::MakeHit(geo::View_t view,
+                              geo::SigType_t signal_type,
+                              geo::WireID const& wireID,
+                              float goodness_of_fit /* = 0. */,
+                              int dof /* = -1 */) const
+  {
+    return {Channel(),
+            StartTick(),
+            EndTick(),
+            PeakTime(),
+            SigmaPeakTime(),
+            RMS(),
+            PeakAmplitude(),
+            SigmaPeakAmplitude(),
+            SummedADC(),
+            Integral(),
+            SigmaIntegral(),
+            Multiplicity(),
+            LocalIndex(),
+            goodness_of_fit,
+            dof,
+            view,
+            signal_type,
+            wireID};
+  } // HitLite::MakeHit()
+
+  //----------------------------------------------------------------------
+  std::uint8_t HitLite::encodeSigma(float sigma)
+  {
+    if (!(sigma >= 0.0f)) return SigmaUnknownCode; // includes NaN
+    if (sigma == 0.0f) return SigmaZeroCode;
+    float const bin = std::floor((std::log2(sigma) - SigmaMinExponent) * SigmaCodesPerOctave);
+    return SigmaFirstCode + static_cast<unsigned int>(std::clamp(bin, 0.0f, 253.0f));
+  } // HitLite::encodeSigma()
+
+  //----------------------------------------------------------------------
+  float HitLite::decodeSigma(unsigned int code)
+  {
+    if (code == SigmaUnknownCode) return -1.0f;
+    if (code == SigmaZeroCode) return 0.0f;
+    // the center of the bin, on logarithmic scale
+    float const bin = float(code - SigmaFirstCode) + 0.5f;
+    return std::exp2(SigmaMinExponent + bin / SigmaCodesPerOctave);
+  } // HitLite::decodeSigma()
+
+  //----------------------------------------------------------------------
+
+} // namespace recob
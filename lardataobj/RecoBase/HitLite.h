@@ -0,0 +1,150 @@
+/** ****************************************************************************
+ * @file lardataobj/RecoBase/HitLite.h
+ * @brief Declaration of a compact signal hit object.
+ * @see  lardataobj/RecoBase/HitLite.cxx
+ */
+
+#ifndef LARDATAOBJ_RECOBASE_HITLITE_H
+#define LARDATAOBJ_RECOBASE_HITLITE_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t, raw::TDCtick_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "lardataobj/RecoBase/Hit.h"
+
+// C/C++ standard libraries
+#include <cstdint> // std::uint8_t
+
+namespace recob {
+
+  /**
+   * @brief Compact version of `recob::Hit`, in 40 bytes.
+   * @see `recob::Hit`
+   *
+   * This object holds most of the information of a `recob::Hit` in 40 bytes,
+   * for events with very many hits.
+   * Compared to `recob::Hit`:
+   *  * channel, start and end tick, peak time, RMS, peak amplitude, summed ADC
+   *    and integral are stored exactly;
+   *  * multiplicity and local index are stored exactly in 16 bits each, the
+   *    same as in `recob::Hit`;
+   *  * the uncertainties on peak time, peak amplitude and integral are
+   *    quantized in 8 bits on a logarithmic scale, with a relative precision
+   *    of about 3.5% between `2^-10` and `2^15`; a negative value (the
+   *    "unknown" default of `recob::Hit`) is stored and returned as `-1`;
+   *  * view, signal type and wire ID are not stored, since they are determined
+   *    by the channel;
+   *  * goodness of fit and degrees of freedom are not stored.
+   *
+   * Any `recob::Hit` can be converted.
+   * A `recob::Hit` is obtained back with `MakeHit()`, which takes the
+   * information that is not stored as arguments; that is usually
+   * obtained from the channel via the geometry service.
+   */
+  class HitLite {
+  public:
+    /// Default constructor: a hit with no signal.
+    HitLite();
+
+    /// Constructor: stores the information from the specified hit.
+    explicit HitLite(recob::Hit const& hit);
+
+    // --- BEGIN -- Accessors ------------------------------------------------
+    /// @name Accessors
+    /// @{
+
+    /// Initial tdc tick for hit
+    raw::TDCtick_t StartTick() const { return fStartTick; }
+
+    /// Final tdc tick for hit
+    raw::TDCtick_t EndTick() const { return fEndTick; }
+
+    /// Time of the signal peak, in tick units
+    float PeakTime() const { return fPeakTime; }
+
+    /// Uncertainty for the signal peak, in tick units (quantized)
+    float SigmaPeakTime() const { return decodeSigma(fSigmaPeakTimeCode); }
+
+    /// RMS of the hit shape, in tick units
+    float RMS() const { return fRMS; }
+
+    /// The estimated amplitude of the hit at its peak, in ADC units
+    float PeakAmplitude() const { return fPeakAmplitude; }
+
+    /// Uncertainty on estimated amplitude of the hit at its peak (quantized)
+    float SigmaPeakAmplitude() const { return decodeSigma(fSigmaPeakAmplitudeCode); }
+
+    /// The sum of calibrated ADC counts of the hit
+    float SummedADC() const { return fSummedADC; }
+
+    /// Integral under the calibrated signal waveform of the hit, in tick x ADC units
+    float Integral() const { return fIntegral; }
+
+    /// Uncertainty of integral under the calibrated signal waveform (quantized)
+    float SigmaIntegral() const { return decodeSigma(fSigmaIntegralCode); }
+
+    /// How many hits could this one be shared with
+    short int Multiplicity() const { return fMultiplicity; }
+
+    /// Index of this hit among the Multiplicity() hits in the signal window
+    short int LocalIndex() const { return fLocalIndex; }
+
+    /// ID of the readout channel the hit was extracted from
+    raw::ChannelID_t Channel() const { return fChannel; }
+
+    /// @}
+    // --- END -- Accessors --------------------------------------------------
+
+    /// Returns `PeakTime() + sigmas x RMS()` (see `recob::Hit`).
+    float PeakTimePlusRMS(float sigmas = +1.) const { return PeakTime() + sigmas * RMS(); }
+
+    /// Returns `PeakTime() - sigmas x RMS()` (see `recob::Hit`).
+    float PeakTimeMinusRMS(float sigmas = +1.) const { return PeakTimePlusRMS(-sigmas); }
+
+    /// Returns the distance of `time` from the peak, in RMS units (no check!).
+    float TimeDistanceAsRMS(float time) const { return (time - PeakTime()) / RMS(); }
+
+    /**
+       * @brief Returns a `recob::Hit` with the content of this hit.
+       * @param view view for the plane of the hit
+       * @param signal_type signal type for the plane of the hit
+       * @param wireID ID of the wire the hit is on
+       * @param goodness_of_fit how well do we believe we know this hit
+       * @param dof degrees of freedom in the determination of the hit shape
+       *
+       * The information not stored in this object is taken from the arguments.
+       */
+    recob::Hit MakeHit(geo::View_t view,
+                       geo::SigType_t signal_type,
+                       geo::WireID const& wireID,
+                       float goodness_of_fit = 0.,
+                       int dof = -1) const;
+
+  private:
+    raw::ChannelID_t fChannel;            ///< ID of the readout channel the hit was extracted from
+    raw::TDCtick_t fStartTick;            ///< initial tdc tick for hit
+    raw::TDCtick_t fEndTick;              ///< final tdc tick for hit
+    float fPeakTime;                      ///< time of the signal peak, in tick units
+    float fRMS;                           ///< RMS of the hit shape, in tick units
+    float fPeakAmplitude;                 ///< the estimated amplitude of the hit at its peak
+    float fSummedADC;                     ///< the sum of calibrated ADC counts of the hit
+    float fIntegral;                      ///< the integral under the calibrated signal waveform
+    short int fMultiplicity;              ///< how many hits could this one be shared with
+    short int fLocalIndex;                ///< index of this hit among the Multiplicity() hits
+    std::uint8_t fSigmaPeakTimeCode;      ///< quantized uncertainty on the peak time
+    std::uint8_t fSigmaPeakAmplitudeCode; ///< quantized uncertainty on the peak amplitude
+    std::uint8_t fSigmaIntegralCode;      ///< quantized uncertainty on the integral
+
+    /// Returns the 8-bit code of an uncertainty.
+    static std::uint8_t encodeSigma(float sigma);
+
+    /// Returns the value of an uncertainty from its 8-bit code.
+    static float decodeSigma(unsigned int code);
+
+  }; // class HitLite
+
+  static_assert(sizeof(HitLite) == 40, "recob::HitLite is expected to take 40 bytes");
+
+} // namespace recob
+
+#endif // LARDATAOBJ_RECOBASE_HITLITE_H
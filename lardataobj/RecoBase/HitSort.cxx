@@ -0,0 +1,203 @@
+/** ****************************************************************************
+ * @file HitSort.cxx
+ * @brief Radix sorting of hit collections by channel or wire, and time.
+ * @see  HitSort.h
+ *
+ * ****************************************************************************/
+
+#include "lardataobj/RecoBase/HitSort.h"
+#include "lardataobj/Utilities/ParallelChunks.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <bit>       // std::bit_cast()
+#include <cstdint>   // std::uint32_t
+#include <numeric>   // std::iota()
+#include <stdexcept> // std::out_of_range
+#include <utility>   // std::move(), std::swap()
+
+namespace {
+
+  /// Returns a pattern of bits with the same order as the time.
+  std::uint32_t orderedTimeBits(float time)
+  {
+    // adding zero turns -0 into +0, which compare equal
+    auto const bits = std::bit_cast<std::uint32_t>(time + 0.0f);
+    // negative numbers: reverse the order; positive: put them after negative
+    return (bits & 0x80000000U) ? ~bits : (bits | 0x80000000U);
+  } // orderedTimeBits()
+
+  /// Returns a key from the upper 32 bits and the peak time.
+  std::uint64_t makeKey(std::uint32_t upper, float peakTime)
+  {
+    return (std::uint64_t(upper) << 32) | orderedTimeBits(peakTime);
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+std::uint64_t recob::HitSortingKey(raw::ChannelID_t channel, float peakTime)
+{
+  return makeKey(channel, peakTime);
+}
+
+//------------------------------------------------------------------------------
+std::uint64_t recob::HitSortingKey(geo::WireID const& wireID, float peakTime)
+{
+  if (!wireID.isValid) return makeKey(0xFFFFFFFFU, peakTime);
+  if ((wireID.Cryostat >= (1U << 4)) || (wireID.TPC >= (1U << 8)) || (wireID.Plane >= (1U << 3)) ||
+      (wireID.Wire >= (1U << 17))) {
+    throw std::out_of_range("recob::HitSortingKey(): wire ID does not fit the sorting key");
+  }
+  std::uint32_t const upper =
+    (wireID.Cryostat << 28) | (wireID.TPC << 20) | (wireID.Plane << 17) | wireID.Wire;
+  return makeKey(upper, peakTime);
+} // recob::HitSortingKey(WireID)
+
+//------------------------------------------------------------------------------
+std::uint64_t recob::HitSortingKey(recob::Hit const& hit, HitSortKey_t key)
+{
+  switch (key) {
+  case HitSortKey_t::Channel: return HitSortingKey(hit.Channel(), hit.PeakTime());
+  case HitSortKey_t::WireID: return HitSortingKey(hit.WireID(), hit.PeakTime());
+  } // switch
+  throw std::logic_error("recob::HitSortingKey(): unsupported sorting criterion");
+} // recob::HitSortingKey(Hit)
+
+//------------------------------------------------------------------------------
+std::vector<std::size_t> recob::SortedHitOrder(std::vector<recob::Hit> const& hits,
+                                               HitSortKey_t key /* = HitSortKey_t::Channel */,
+                                               unsigned int nThreads /* = 1 */)
+{
+  std::vector<std::uint64_t> keys;
+  keys.reserve(hits.size());
+  for (recob::Hit const& hit : hits)
+    keys.push_back(HitSortingKey(hit, key));
+  return RadixSortOrder(keys, nThreads);
+} // recob::SortedHitOrder()
+
+//------------------------------------------------------------------------------
+std::vector<std::size_t> recob::SortedHitOrder(recob::HitColumns const& hits,
+                                               HitSortKey_t key /* = HitSortKey_t::Channel */,
+                                               unsigned int nThreads /* = 1 */)
+{
+  auto const channels = hits.Channels();
+  auto const times = hits.PeakTimes();
+  std::vector<std::uint64_t> keys(hits.size());
+  switch (key) {
+  case HitSortKey_t::Channel:
+    for (std::size_t i = 0; i < keys.size(); ++i)
+      keys[i] = HitSortingKey(channels[i], times[i]);
+    break;
+  case HitSortKey_t::WireID:
+    for (std::size_t i = 0; i < keys.size(); ++i)
+      keys[i] = HitSortingKey(hits[i].WireID(), times[i]);
+    break;
+  } // switch
+  return RadixSortOrder(keys, nThreads);
+} // recob::SortedHitOrder(HitColumns)
+
+//------------------------------------------------------------------------------
+void recob::SortHits(std::vector<recob::Hit>& hits,
+                     HitSortKey_t key /* = HitSortKey_t::Channel */,
+                     unsigned int nThreads /* = 1 */)
+{
+  std::vector<std::size_t> const order = SortedHitOrder(hits, key, nThreads);
+  std::vector<recob::Hit> sorted;
+  sorted.reserve(hits.size());
+  for (std::size_t const i : order)
+    sorted.push_back(std::move(hits[i]));
+  hits = std::move(sorted);
+} // recob::SortHits()
+
+//------------------------------------------------------------------------------
+std::vector<std::size_t> recob::RadixSortOrder(std::vector<std::uint64_t> const& keys,
+                                               unsigned int nThreads /* = 1 */)
+{
+  constexpr unsigned int DigitBits = 8;
+  constexpr unsigned int NDigits = 64 / DigitBits;
+  constexpr std::size_t NBuckets = std::size_t(1) << DigitBits;
+  constexpr std::uint64_t DigitMask = NBuckets - 1;
+  constexpr std::size_t MinChunkSize = 16384; // smaller chunks are not worth a thread
+
+  using Histogram_t = std::array<std::size_t, NBuckets>;
+
+  std::size_t const n = keys.size();
+
+  // each chunk of keys is processed by its own thread, in all passes
+  std::vector<std::size_t> const bounds = util::ChunkBoundaries(n, nThreads, MinChunkSize);
+  std::size_t const nChunks = bounds.size() - 1;
+
+  // histograms of all the digits, in a single pass (per chunk, then summed);
+  // they are used to skip the digits which are the same for all keys
+  std::vector<std::array<Histogram_t, NDigits>> chunkCounts(nChunks);
+  util::ForEachChunk(bounds, [&](std::size_t iChunk, std::size_t begin, std::size_t end) {
+    auto& counts = chunkCounts[iChunk];
+    for (auto& count : counts)
+      count.fill(0);
+    for (std::size_t i = begin; i < end; ++i) {
+      for (unsigned int d = 0; d < NDigits; ++d)
+        ++counts[d][(keys[i] >> (d * DigitBits)) & DigitMask];
+    }
+  });
+  std::array<Histogram_t, NDigits> totalCounts = chunkCounts.front();
+  for (std::size_t iChunk = 1; iChunk < nChunks; ++iChunk) {
+    for (unsigned int d = 0; d < NDigits; ++d) {
+      for (std::size_t b = 0; b < NBuckets; ++b)
+        totalCounts[d][b] += chunkCounts[iChunk][d][b];
+    }
+  }
+
+  std::vector<std::uint64_t> srcKeys{keys}, dstKeys(n);
+  std::vector<std::size_t> srcOrder(n), dstOrder(n);
+  std::iota(srcOrder.begin(), srcOrder.end(), 0);
+
+  // starting position of each bucket for each chunk
+  std::vector<Histogram_t> positions(nChunks);
+  bool first = true; // the chunk histograms are still those of the original order
+
+  for (unsigned int d = 0; d < NDigits; ++d) {
+    unsigned int const shift = d * DigitBits;
+
+    // if all keys have the same digit, this pass would not change the order
+    if ((n == 0) || (totalCounts[d][(srcKeys.front() >> shift) & DigitMask] == n)) continue;
+
+    // histogram of this digit in each chunk of the current order
+    util::ForEachChunk(bounds, [&](std::size_t iChunk, std::size_t begin, std::size_t end) {
+      Histogram_t& count = positions[iChunk];
+      if (first) {
+        count = chunkCounts[iChunk][d];
+        return;
+      }
+      count.fill(0);
+      for (std::size_t i = begin; i < end; ++i)
+        ++count[(srcKeys[i] >> shift) & DigitMask];
+    });
+    first = false;
+
+    // turn the counts into the starting position of each bucket in each
+    // chunk: the keys of a chunk go after the ones with the same digit from
+    // the previous chunks, which keeps the sort stable
+    std::size_t position = 0;
+    for (std::size_t b = 0; b < NBuckets; ++b) {
+      for (Histogram_t& count : positions) {
+        std::size_t const bucketSize = count[b];
+        count[b] = position;
+        position += bucketSize;
+      }
+    }
+
+    util::ForEachChunk(bounds, [&](std::size_t iChunk, std::size_t begin, std::size_t end) {
+      Histogram_t& count = positions[iChunk];
+      for (std::size_t i = begin; i < end; ++i) {
+        std::size_t const target = count[(srcKeys[i] >> shift) & DigitMask]++;
+        dstKeys[target] = srcKeys[i];
+        dstOrder[target] = srcOrder[i];
+      }
+    });
+    std::swap(srcKeys, dstKeys);
+    std::swap(srcOrder, dstOrder);
+  } // for digits
+
+  return srcOrder;
+} // recob::RadixSortOrder()
@@ -0,0 +1,113 @@
+/** ****************************************************************************
+ * @file lardataobj/RecoBase/HitSort.h
+ * @brief Radix sorting of hit collections by channel or wire, and time.
+ * @see  lardataobj/RecoBase/HitSort.cxx
+ */
+
+#ifndef LARDATAOBJ_RECOBASE_HITSORT_H
+#define LARDATAOBJ_RECOBASE_HITSORT_H
+
+// LArSoft libraries
+#include "lardataobj/RecoBase/Hit.h"
+#include "lardataobj/RecoBase/HitColumns.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <vector>
+
+namespace recob {
+
+  /// Criteria for sorting hits.
+  enum class HitSortKey_t {
+    Channel, ///< By channel ID, then by peak time.
+    WireID   ///< By wire ID (cryostat, TPC, plane, wire), then by peak time.
+  };
+
+  /**
+   * @brief Returns a 64-bit key whose order is the sorting order of the hit.
+   * @param channel the channel of the hit
+   * @param peakTime the peak time of the hit
+   * @return the sorting key
+   *
+   * The channel makes the upper 32 bits of the key, and the peak time the
+   * lower ones, with a bit pattern which preserves the order of all times
+   * (so no precision is lost).
+   */
+  std::uint64_t HitSortingKey(raw::ChannelID_t channel, float peakTime);
+
+  /**
+   * @brief Returns a 64-bit key whose order is the sorting order of the hit.
+   * @param wireID the wire the hit is on
+   * @param peakTime the peak time of the hit
+   * @return the sorting key
+   * @throw std::out_of_range if the wire ID does not fit the key
+   *
+   * The wire ID makes the upper 32 bits of the key, with 4 bits for the
+   * cryostat, 8 for the TPC, 3 for the plane and 17 for the wire number;
+   * invalid wire IDs are sorted after all the valid ones.
+   * The peak time is stored in the lower bits as in the channel version.
+   */
+  std::uint64_t HitSortingKey(geo::WireID const& wireID, float peakTime);
+
+  /// Returns the sorting key of `hit` according to the criterion `key`.
+  std::uint64_t HitSortingKey(recob::Hit const& hit, HitSortKey_t key);
+
+  /**
+   * @brief Returns the sorted order of the hits.
+   * @param hits the hits to be sorted
+   * @param key the sorting criterion
+   * @param nThreads (default: `1`) number of threads for the sorting
+   *                 (`0`: hardware threads; see `util::ResolveThreads()`)
+   * @return the list of hit indices in sorted order
+   *
+   * The element `i` of the returned list is the index in `hits` of the hit
+   * which is the `i`-th in sorted order (that is, `hits[order[0]]` is the
+   * first hit).
+   * The sorting is stable: hits with the same key keep their relative order.
+   * This list can be used to remap the indices of associations.
+   *
+   * The sorting is a least significant digit radix sort on the sorting key
+   * (`HitSortingKey()`), which takes a time linear in the number of hits;
+   * if requested, large collections are sorted in chunks by up to `nThreads`
+   * threads (see `RadixSortOrder()`), with a result independent of their
+   * number.
+   * With the `HitSortKey_t::Channel` criterion, the order is the same as with
+   * `std::stable_sort()` and `operator< (recob::Hit const&, recob::Hit const&)`
+   * for hits whose view is determined by the channel.
+   */
+  std::vector<std::size_t> SortedHitOrder(std::vector<recob::Hit> const& hits,
+                                          HitSortKey_t key = HitSortKey_t::Channel,
+                                          unsigned int nThreads = 1);
+
+  /// Returns the sorted order of the hits (see the `recob::Hit` version).
+  std::vector<std::size_t> SortedHitOrder(recob::HitColumns const& hits,
+                                          HitSortKey_t key = HitSortKey_t::Channel,
+                                          unsigned int nThreads = 1);
+
+  /// Sorts the hits in place (see `SortedHitOrder()`).
+  void SortHits(std::vector<recob::Hit>& hits,
+                HitSortKey_t key = HitSortKey_t::Channel,
+                unsigned int nThreads = 1);
+
+  /**
+   * @brief Returns the order that sorts the specified keys (stable).
+   * @param keys the sorting keys
+   * @param nThreads (default: `1`) number of threads for the sorting
+   *                 (`0`: hardware threads; see `util::ResolveThreads()`)
+   * @return the list of key indices in sorted order
+   *
+   * This is the radix sort used by `SortedHitOrder()`.
+   * The keys are split in contiguous chunks, one per thread (see
+   * `util::ForEachChunk()`; small collections are sorted in a single chunk).
+   * In each pass, each thread counts the digits of its chunk; a prefix sum
+   * over the digits and the chunks gives each chunk its own starting position
+   * in each bucket, and then each thread moves the keys of its chunk.
+   * The threads are started anew in each pass.
+   */
+  std::vector<std::size_t> RadixSortOrder(std::vector<std::uint64_t> const& keys,
+                                          unsigned int nThreads = 1);
+
+} // namespace recob
+
+#endif // LARDATAOBJ_RECOBASE_HITSORT_H
@@ -0,0 +1,106 @@
+/** ****************************************************************************
+ * @file HitWireTimeIndex.cxx
+ * @brief Index of a collection of hits by plane, wire and peak time.
+ * @see  HitWireTimeIndex.h
+ *
+ * ****************************************************************************/
+
+#include "lardataobj/RecoBase/HitWireTimeIndex.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort()
+#include <cmath>     // std::isnan()
+#include <numeric>   // std::iota()
+#include <tuple>     // std::tie()
+#include <utility>   // std::move()
+
+namespace recob {
+
+  //----------------------------------------------------------------------
+  HitWireTimeIndex::HitWireTimeIndex(std::vector<recob::Hit> const& hits)
+  {
+    std::vector<geo::PlaneID> planes;
+    planes.reserve(hits.size());
+    fHits.reserve(hits.size());
+    for (size_type iHit = 0; iHit < hits.size(); ++iHit) {
+      geo::WireID const& wireID = hits[iHit].WireID();
+      if (!wireID.isValid || std::isnan(hits[iHit].PeakTime())) continue;
+      planes.push_back(wireID.planeID());
+      fHits.push_back({wireID.Wire, hits[iHit].PeakTime(), iHit});
+    }
+    buildIndex(planes);
+  } // HitWireTimeIndex::HitWireTimeIndex()
+
+  //----------------------------------------------------------------------
+  HitWireTimeIndex::HitWireTimeIndex(recob::HitColumns const& hits)
+  {
+    std::vector<geo::PlaneID> planes;
+    planes.reserve(hits.size());
+    fHits.reserve(hits.size());
+    for (size_type iHit = 0; iHit < hits.size(); ++iHit) {
+      geo::WireID const wireID = hits[iHit].WireID();
+      if (!wireID.isValid || std::isnan(hits.PeakTimes()[iHit])) continue;
+      planes.push_back(wireID.planeID());
+      fHits.push_back({wireID.Wire, hits.PeakTimes()[iHit], iHit});
+    }
+    buildIndex(planes);
+  } // HitWireTimeIndex::HitWireTimeIndex(HitColumns)
+
+  //----------------------------------------------------------------------
+  HitWireTimeIndex::size_type HitWireTimeIndex::NHits(geo::PlaneID const& plane) const
+  {
+    PlaneInfo_t const* info = findPlane(plane);
+    return info ? info->end - info->first : 0;
+  } // HitWireTimeIndex::NHits()
+
+  //----------------------------------------------------------------------
+  std::vector<HitWireTimeIndex::size_type> HitWireTimeIndex::InRange(geo::PlaneID const& plane,
+                                                                     WireNo_t firstWire,
+                                                                     WireNo_t lastWire,
+                                                                     float startTime,
+                                                                     float endTime) const
+  {
+    std::vector<size_type> hits;
+    ForEachInRange(
+      plane, firstWire, lastWire, startTime, endTime, [&hits](size_type iHit) {
+        hits.push_back(iHit);
+      });
+    return hits;
+  } // HitWireTimeIndex::InRange()
+
+  //----------------------------------------------------------------------
+  void HitWireTimeIndex::buildIndex(std::vector<geo::PlaneID> const& planes)
+  {
+    // sort a permutation, since plane IDs are not stored with the hits
+    std::vector<size_type> order(fHits.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this, &planes](size_type a, size_type b) {
+      HitInfo_t const& A = fHits[a];
+      HitInfo_t const& B = fHits[b];
+      if (planes[a] != planes[b]) return planes[a] < planes[b];
+      return std::tie(A.wire, A.time, A.hit) < std::tie(B.wire, B.time, B.hit);
+    });
+
+    std::vector<HitInfo_t> sorted;
+    sorted.reserve(fHits.size());
+    for (size_type i = 0; i < order.size(); ++i) {
+      geo::PlaneID const& plane = planes[order[i]];
+      if (fPlanes.empty() || (fPlanes.back().plane != plane))
+        fPlanes.push_back({plane, i, i});
+      ++fPlanes.back().end;
+      sorted.push_back(fHits[order[i]]);
+    }
+    fHits = std::move(sorted);
+  } // HitWireTimeIndex::buildIndex()
+
+  //----------------------------------------------------------------------
+  HitWireTimeIndex::PlaneInfo_t const* HitWireTimeIndex::findPlane(geo::PlaneID const& plane) const
+  {
+    auto const it = std::lower_bound(
+      fPlanes.begin(), fPlanes.end(), plane, [](PlaneInfo_t const& info, geo::PlaneID const& id) {
+        return info.plane < id;
+      });
+    return ((it == fPlanes.end()) || (it->plane != plane)) ? nullptr : &*it;
+  } // HitWireTimeIndex::findPlane()
+
+} // namespace recob
@@ -0,0 +1,164 @@
+/** ****************************************************************************
+ * @file lardataobj/RecoBase/HitWireTimeIndex.h
+ * @brief Index of a collection of hits by plane, wire and peak time.
+ * @see  lardataobj/RecoBase/HitWireTimeIndex.cxx
+ */
+
+#ifndef LARDATAOBJ_RECOBASE_HITWIRETIMEINDEX_H
+#define LARDATAOBJ_RECOBASE_HITWIRETIMEINDEX_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h" // geo::PlaneID, geo::WireID
+#include "lardataobj/RecoBase/Hit.h"
+#include "lardataobj/RecoBase/HitColumns.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::lower_bound(), std::partition_point()
+#include <cstddef>   // std::size_t
+#include <vector>
+
+namespace recob {
+
+  /**
+   * @brief Index of hits sorted by plane, wire and peak time.
+   *
+   * The index is built once from a collection of hits (either
+   * `std::vector<recob::Hit>` or `recob::HitColumns`) and answers queries of
+   * the type "which hits are on plane `P`, on wires `[w0, w1]`, with peak
+   * time in `[t0, t1]`", returning the indices of the hits in the original
+   * collection (so that they can be used to make `art::Ptr` or to navigate
+   * associations).
+   *
+   * The hits are sorted by plane, then by wire, then by peak time.
+   * The first hit of each wire in the query is found by binary search, and a
+   * query takes a time proportional to @f$ W \log n + k @f$, where @f$ W @f$
+   * is the number of wires with hits in the query range, @f$ n @f$ the number
+   * of hits on the plane and @f$ k @f$ the number of hits returned.
+   * Building the index takes @f$ n \log n @f$.
+   *
+   * Hits with an invalid wire ID or with a NaN peak time are not indexed
+   * (the latter could not be sorted by time).
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * recob::HitWireTimeIndex const index{hits};
+   * for (std::size_t iHit: index.InRange(planeID, w0, w1, t0, t1)) {
+   *   art::Ptr<recob::Hit> const hitPtr{hitHandle, iHit};
+   *   // ...
+   * }
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * The index does not refer to the hit collection after construction.
+   */
+  class HitWireTimeIndex {
+  public:
+    using size_type = std::size_t;
+    using WireNo_t = geo::WireID::WireID_t;
+
+    /// Default constructor: an empty index.
+    HitWireTimeIndex() = default;
+
+    /// Constructor: indexes all the hits with a valid wire ID and peak time.
+    explicit HitWireTimeIndex(std::vector<recob::Hit> const& hits);
+
+    /// Constructor: indexes all the hits with a valid wire ID and peak time.
+    explicit HitWireTimeIndex(recob::HitColumns const& hits);
+
+    /// Returns the number of indexed hits.
+    size_type size() const { return fHits.size(); }
+
+    /// Returns whether no hit is indexed.
+    bool empty() const { return fHits.empty(); }
+
+    /// Returns the number of indexed hits on the specified plane.
+    size_type NHits(geo::PlaneID const& plane) const;
+
+    /**
+       * @brief Calls `op` on the index of each hit in the specified range.
+       * @tparam Op type of callable object, taking a `std::size_t` argument
+       * @param plane the plane of the hits
+       * @param firstWire the first wire of the range
+       * @param lastWire the last wire of the range (included)
+       * @param startTime the lowest peak time in the range
+       * @param endTime the highest peak time in the range (included)
+       * @param op the operation to be called
+       *
+       * Hits are visited by wire, then by peak time.
+       */
+    template <typename Op>
+    void ForEachInRange(geo::PlaneID const& plane,
+                        WireNo_t firstWire,
+                        WireNo_t lastWire,
+                        float startTime,
+                        float endTime,
+                        Op op) const;
+
+    /// Returns the indices of the hits in the specified range, by wire and time.
+    std::vector<size_type> InRange(geo::PlaneID const& plane,
+                                   WireNo_t firstWire,
+                                   WireNo_t lastWire,
+                                   float startTime,
+                                   float endTime) const;
+
+  private:
+    /// Information about an indexed hit.
+    struct HitInfo_t {
+      WireNo_t wire; ///< Wire number of the hit.
+      float time;    ///< Peak time of the hit.
+      size_type hit; ///< Index of the hit in the original collection.
+    }; // HitInfo_t
+
+    /// Range of indexed hits on a plane.
+    struct PlaneInfo_t {
+      geo::PlaneID plane; ///< ID of the plane.
+      size_type first;    ///< Index of the first hit of the plane in `fHits`.
+      size_type end;      ///< Index after the last hit of the plane in `fHits`.
+    }; // PlaneInfo_t
+
+    std::vector<PlaneInfo_t> fPlanes; ///< Planes with hits, sorted by ID.
+    std::vector<HitInfo_t> fHits;     ///< Hits, sorted by plane, wire and time.
+
+    /// Sorts the hits (with their plane in `planes`) and fills the index.
+    void buildIndex(std::vector<geo::PlaneID> const& planes);
+
+    /// Returns the information of the specified plane, `nullptr` if no hits.
+    PlaneInfo_t const* findPlane(geo::PlaneID const& plane) const;
+
+  }; // class HitWireTimeIndex
+
+} // namespace recob
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Op>
+void recob::HitWireTimeIndex::ForEachInRange(geo::PlaneID const& plane,
+                                             WireNo_t firstWire,
+                                             WireNo_t lastWire,
+                                             float startTime,
+                                             float endTime,
+                                             Op op) const
+{
+  if ((firstWire > lastWire) || !(startTime <= endTime)) return;
+  PlaneInfo_t const* info = findPlane(plane);
+  if (!info) return;
+
+  auto const byWire = [](HitInfo_t const& hit, WireNo_t wire) { return hit.wire < wire; };
+  auto const planeEnd = fHits.begin() + info->end;
+  auto it = std::lower_bound(fHits.begin() + info->first, planeEnd, firstWire, byWire);
+  while ((it != planeEnd) && (it->wire <= lastWire)) {
+    WireNo_t const wire = it->wire;
+    // first hit on this wire not earlier than the start time
+    it = std::partition_point(it, planeEnd, [wire, startTime](HitInfo_t const& hit) {
+      return (hit.wire == wire) && (hit.time < startTime);
+    });
+    for (; (it != planeEnd) && (it->wire == wire) && (it->time <= endTime); ++it)
+      op(it->hit);
+    // skip the rest of this wire
+    if ((it != planeEnd) && (it->wire == wire)) {
+      if (wire == lastWire) break;
+      it = std::lower_bound(it, planeEnd, wire + 1, byWire);
+    }
+  } // while
+} // recob::HitWireTimeIndex::ForEachInRange()
+
+//------------------------------------------------------------------------------
+
+#endif // LARDATAOBJ_RECOBASE_HITWIRETIMEINDEX_H
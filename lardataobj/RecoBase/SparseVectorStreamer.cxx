@@ -0,0 +1,145 @@
+/**
+ * @file   SparseVectorStreamer.cxx
+ * @brief  Compact ROOT streamer for `lar::sparse_vector<float>`.
+ * @see    SparseVectorStreamer.h
+ */
+
+#include "lardataobj/RecoBase/SparseVectorStreamer.h"
+
+// LArSoft libraries
+#include "lardataobj/Utilities/sparse_vector.h"
+#include "lardataobj/Utilities/sparse_vector_packing.h"
+
+// ROOT libraries
+#include "TBuffer.h"
+#include "TClass.h"
+#include "TClassRef.h"
+#include "TClassStreamer.h"
+#include "TError.h"
+
+namespace {
+
+  using SparseVector_t = lar::sparse_vector<float>;
+
+  /// Class version the packed form is written with. The member-wise layout is
+  /// written with the dictionary version (`lar::sparse_vector<float>` has no
+  /// `ClassVersion`, so that is `0` or `1`), and a reader without this
+  /// streamer fails to find a streamer info for it instead of misreading it.
+  constexpr Version_t PackedVersion = 1000;
+
+  //----------------------------------------------------------------------
+  class SparseVectorStreamer : public TClassStreamer {
+  public:
+    explicit SparseVectorStreamer(bool writePacked)
+      : TClassStreamer(nullptr), fClass("lar::sparse_vector<float>"), fWritePacked(writePacked)
+    {}
+
+    void operator()(TBuffer& buf, void* objp) override
+    {
+      if (buf.IsReading())
+        read(buf, objp);
+      else if (fWritePacked)
+        writePacked(buf, *static_cast<SparseVector_t const*>(objp));
+      else
+        fClass->WriteBuffer(buf, objp);
+    }
+
+    TClassStreamer* Generate() const override { return new SparseVectorStreamer(*this); }
+
+  private:
+    TClassRef fClass;  ///< The class of `lar::sparse_vector<float>`.
+    bool fWritePacked; ///< Whether to write in packed form.
+
+    void read(TBuffer& buf, void* objp) const;
+    void writePacked(TBuffer& buf, SparseVector_t const& sv) const;
+
+    /// Reads an array size, returning `-1` if there aren't enough bytes left.
+    static Int_t readArraySize(TBuffer& buf, Int_t elementSize, Int_t endPos);
+
+  }; // class SparseVectorStreamer
+
+  //----------------------------------------------------------------------
+  void SparseVectorStreamer::read(TBuffer& buf, void* objp) const
+  {
+    UInt_t start = 0, count = 0;
+    Version_t const version = buf.ReadVersion(&start, &count, fClass);
+
+    // standard layout: leave it to the dictionary
+    if (version != PackedVersion) {
+      fClass->ReadBuffer(buf, objp, version, start, count);
+      return;
+    }
+
+    auto& sv = *static_cast<SparseVector_t*>(objp);
+    Int_t const endPos = count ? Int_t(start + count + sizeof(UInt_t)) : buf.BufferSize();
+
+    lar::packed_sparse_vector<float> packed;
+    ULong64_t size = 0;
+    buf >> size;
+    packed.size = size;
+
+    Int_t n = readArraySize(buf, sizeof(UChar_t), endPos);
+    if (n >= 0) {
+      packed.borders.resize(n);
+      buf.ReadFastArray(reinterpret_cast<UChar_t*>(packed.borders.data()), n);
+      n = readArraySize(buf, sizeof(Float_t), endPos);
+    }
+    if (n < 0) {
+      ::Error("lar::sparse_vector<float>::Streamer",
+              "corrupted packed data at offset %u, object skipped",
+              start);
+      sv.clear();
+      buf.SetBufferOffset(endPos);
+      return;
+    }
+    packed.values.resize(n);
+    buf.ReadFastArray(packed.values.data(), n);
+
+    buf.CheckByteCount(start, count, fClass);
+
+    sv = lar::unpack_sparse_vector(packed);
+  } // SparseVectorStreamer::read()
+
+  //----------------------------------------------------------------------
+  Int_t SparseVectorStreamer::readArraySize(TBuffer& buf, Int_t elementSize, Int_t endPos)
+  {
+    Int_t n = 0;
+    buf >> n;
+    if ((n < 0) || (n > (endPos - buf.Length()) / elementSize)) return -1;
+    return n;
+  } // SparseVectorStreamer::readArraySize()
+
+  //----------------------------------------------------------------------
+  void SparseVectorStreamer::writePacked(TBuffer& buf, SparseVector_t const& sv) const
+  {
+    lar::packed_sparse_vector<float> const packed = lar::pack_sparse_vector(sv);
+
+    // same as `TBuffer::WriteVersion()` with byte count, but with our version
+    UInt_t const countPos = buf.Length();
+    buf << UInt_t(0);
+    buf << PackedVersion;
+    buf << ULong64_t(packed.size);
+    buf << Int_t(packed.borders.size());
+    buf.WriteFastArray(reinterpret_cast<UChar_t const*>(packed.borders.data()),
+                       packed.borders.size());
+    buf << Int_t(packed.values.size());
+    buf.WriteFastArray(packed.values.data(), packed.values.size());
+    buf.SetByteCount(countPos, kTRUE);
+  } // SparseVectorStreamer::writePacked()
+
+} // local namespace
+
+//----------------------------------------------------------------------
+TClassStreamer* lar::MakeSparseVectorStreamer(bool writePacked /* = false */)
+{
+  return new SparseVectorStreamer(writePacked);
+}
+
+//----------------------------------------------------------------------
+bool lar::InstallSparseVectorStreamer(bool writePacked /* = true */)
+{
+  TClass* cl = TClass::GetClass<SparseVector_t>();
+  if (!cl || !cl->HasDictionary()) return false;
+  cl->AdoptStreamer(MakeSparseVectorStreamer(writePacked));
+  return true;
+} // lar::InstallSparseVectorStreamer()
@@ -0,0 +1,69 @@
+/**
+ * @file   lardataobj/RecoBase/SparseVectorStreamer.h
+ * @brief  Compact ROOT streamer for `lar::sparse_vector<float>`.
+ * @see    lardataobj/RecoBase/SparseVectorStreamer.cxx
+ *
+ * The regions of interest of `recob::Wire` and `recob::OpWaveform` are stored
+ * in `lar::sparse_vector<float>` objects. With the dictionary alone, ROOT
+ * writes them as a collection of ranges, each with its own header and its
+ * own `std::vector<float>`.
+ * The streamer can write instead the packed form described in
+ * `lar::packed_sparse_vector`: the range borders as delta-encoded
+ * variable-length integers, and all the values as a single contiguous array,
+ * which is faster to stream and compresses better.
+ *
+ * Versioning and compatibility
+ * -----------------------------
+ *
+ * The packed form is written with its own class version (`1000`), distinct
+ * from the one of the member-wise layout. The streamer reads both: the packed
+ * form by itself, the standard layout through the dictionary as usual, so
+ * files written before the streamer was introduced are still read correctly.
+ * A reader without the streamer (e.g. an older release) reports that it
+ * can't find the streamer information for the packed version and skips the
+ * object, rather than misinterpreting its content.
+ *
+ * Installation
+ * -------------
+ *
+ * The dictionary library of `lardataobj/RecoBase` attaches a streamer to
+ * `lar::sparse_vector<float>` when it is loaded, so reading packed data needs
+ * no action from the job. That streamer writes the standard member-wise
+ * layout (note that a class with a custom streamer is not split in trees).
+ * Writing the packed form is opt-in: the job must call
+ * `lar::InstallSparseVectorStreamer()`, typically from one of its services,
+ * before opening any output file.
+ */
+
+#ifndef LARDATAOBJ_RECOBASE_SPARSEVECTORSTREAMER_H
+#define LARDATAOBJ_RECOBASE_SPARSEVECTORSTREAMER_H
+
+class TClassStreamer;
+
+namespace lar {
+
+  /**
+   * @brief Returns a new streamer for `lar::sparse_vector<float>`.
+   * @param writePacked (default: `false`) whether to write in packed form
+   * @return the streamer, owned by the caller
+   *
+   * The streamer reads both the packed form and the member-wise layout.
+   * This is the streamer the dictionary registers (not writing packed).
+   */
+  TClassStreamer* MakeSparseVectorStreamer(bool writePacked = false);
+
+  /**
+   * @brief Installs the compact ROOT streamer for `lar::sparse_vector<float>`.
+   * @param writePacked (default: `true`) whether to write in packed form
+   * @return whether the streamer could be installed
+   *
+   * The dictionary of `lar::sparse_vector<float>` must be already loaded.
+   * If `writePacked` is `false`, the streamer is the same as the one from the
+   * dictionary, reading packed data but writing the member-wise layout.
+   * The function can be called multiple times, the last setting prevailing.
+   */
+  bool InstallSparseVectorStreamer(bool writePacked = true);
+
+} // namespace lar
+
+#endif // LARDATAOBJ_RECOBASE_SPARSEVECTORSTREAMER_H
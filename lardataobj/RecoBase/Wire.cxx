@@ -9,7 +9,8 @@
 #include "lardataobj/RecoBase/Wire.h"
 
 // C/C++ standard libraries
-#include <utility> // std::move()
+#include <stdexcept> // std::length_error
+#include <utility>   // std::move()
 
 namespace recob {
 
@@ -32,5 +33,19 @@ namespace recob {
     return {fSignalROI.begin(), fSignalROI.end()};
   } // Wire::Signal()
 
+  //----------------------------------------------------------------------
+  void Wire::FillSignal(std::span<float> out) const
+  {
+    if (out.size() < NSignal())
+      throw std::length_error("recob::Wire::FillSignal(): buffer too small for the signal");
+    fSignalROI.copy_to(out.first(NSignal()));
+  } // Wire::FillSignal()
+
+  //----------------------------------------------------------------------
+  void Wire::FillSignal(std::span<float> out, std::size_t firstTick) const
+  {
+    fSignalROI.copy_to(out, firstTick);
+  } // Wire::FillSignal(std::size_t)
+
 }
 ////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 
 // C/C++ standard libraries
 #include <cstddef> // std::size_t
+#include <span>
 #include <vector>
 
 namespace recob {
@@ -177,6 +178,26 @@ namespace recob {
     /// Return a zero-padded full length vector filled with RoI signal
     std::vector<float> Signal() const;
 
+    /**
+       * @brief Writes the zero-padded full signal into an existing buffer.
+       * @param out the buffer to be written; it must hold at least `NSignal()`
+       *            ticks
+       * @throw std::length_error if `out` is smaller than `NSignal()`
+       *
+       * This is the same content as `Signal()`, written into memory owned by
+       * the caller, which can reuse it for many channels. Only the first
+       * `NSignal()` elements of `out` are written.
+       */
+    void FillSignal(std::span<float> out) const;
+
+    /**
+       * @brief Writes the zero-padded signal of a range of ticks into a buffer.
+       * @param out the buffer to be written; its size is the number of ticks
+       * @param firstTick the tick to be written into `out[0]`
+       * @throw std::out_of_range if the range extends beyond `NSignal()`
+       */
+    void FillSignal(std::span<float> out, std::size_t firstTick) const;
+
     /// Returns the list of regions of interest
     const RegionsOfInterest_t& SignalROI() const;
 
@@ -0,0 +1,184 @@
+/** ****************************************************************************
+ * @file WireBlock.cxx
+ * @brief Definition of a columnar collection of channel signals.
+ * @see  WireBlock.h
+ *
+ * ****************************************************************************/
+
+#include "lardataobj/RecoBase/WireBlock.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::upper_bound(), std::fill()
+#include <stdexcept> // std::out_of_range, std::length_error
+#include <string>    // std::to_string()
+
+namespace recob {
+
+  //----------------------------------------------------------------------
+  WireBlock::WireBlock(std::vector<recob::Wire> const& wires)
+  {
+    size_type nRanges = 0, nSamples = 0;
+    for (recob::Wire const& wire : wires) {
+      nRanges += wire.SignalROI().n_ranges();
+      nSamples += wire.SignalROI().count();
+    }
+    Reserve(wires.size(), nRanges, nSamples);
+    for (recob::Wire const& wire : wires)
+      AddWire(wire);
+  } // WireBlock::WireBlock()
+
+  //----------------------------------------------------------------------
+  void WireBlock::Reserve(size_type nChannels, size_type nRanges, size_type nSamples)
+  {
+    fChannels.reserve(nChannels);
+    fViews.reserve(nChannels);
+    fNSignal.reserve(nChannels);
+    fRangeOffsets.reserve(nChannels + 1);
+    fRangeBegins.reserve(nRanges);
+    fSampleOffsets.reserve(nRanges + 1);
+    fSamples.reserve(nSamples);
+  } // WireBlock::Reserve()
+
+  //----------------------------------------------------------------------
+  void WireBlock::AddChannel(raw::ChannelID_t channel,
+                             geo::View_t view,
+                             RegionsOfInterest_t const& signal)
+  {
+    fChannels.push_back(channel);
+    fViews.push_back(view);
+    fNSignal.push_back(signal.size());
+    for (auto const& range : signal.get_ranges()) {
+      fRangeBegins.push_back(range.begin_index());
+      fSamples.insert(fSamples.end(), range.begin(), range.end());
+      fSampleOffsets.push_back(fSamples.size());
+    }
+    fRangeOffsets.push_back(fRangeBegins.size());
+  } // WireBlock::AddChannel()
+
+  //----------------------------------------------------------------------
+  void WireBlock::AddWire(recob::Wire const& wire)
+  {
+    AddChannel(wire.Channel(), wire.View(), wire.SignalROI());
+  } // WireBlock::AddWire()
+
+  //----------------------------------------------------------------------
+  WireBlock::ChannelView WireBlock::at(size_type index) const
+  {
+    if (index >= NChannels()) {
+      throw std::out_of_range("recob::WireBlock::at(): channel index " + std::to_string(index) +
+                              " out of range (" + std::to_string(NChannels()) + " channels)");
+    }
+    return (*this)[index];
+  } // WireBlock::at()
+
+  //----------------------------------------------------------------------
+  std::vector<recob::Wire> WireBlock::ToWires() const
+  {
+    std::vector<recob::Wire> wires;
+    wires.reserve(NChannels());
+    for (size_type i = 0; i < NChannels(); ++i)
+      wires.push_back((*this)[i].MakeWire());
+    return wires;
+  } // WireBlock::ToWires()
+
+  //----------------------------------------------------------------------
+  //--- WireBlock::ChannelView
+  //----------------------------------------------------------------------
+  std::vector<float> WireBlock::ChannelView::Signal() const
+  {
+    std::vector<float> signal(NSignal(), 0.0f);
+    FillSignal(signal);
+    return signal;
+  } // WireBlock::ChannelView::Signal()
+
+  //----------------------------------------------------------------------
+  void WireBlock::ChannelView::FillSignal(std::span<float> out) const
+  {
+    if (out.size() < NSignal()) {
+      throw std::length_error(
+        "recob::WireBlock::ChannelView::FillSignal(): buffer too small for the signal");
+    }
+    FillSignal(out.first(NSignal()), 0);
+  } // WireBlock::ChannelView::FillSignal()
+
+  //----------------------------------------------------------------------
+  void WireBlock::ChannelView::FillSignal(std::span<float> out, size_type firstTick) const
+  {
+    size_type const lastTick = firstTick + out.size();
+    if ((lastTick > NSignal()) || (lastTick < firstTick)) {
+      throw std::out_of_range(
+        "recob::WireBlock::ChannelView::FillSignal(): ticks beyond the end of the signal");
+    }
+
+    auto iOut = out.begin();
+    size_type pos = firstTick;
+    for (size_type i = findRange(firstTick) - rangeBegin(); i < n_ranges(); ++i) {
+      RangeView const range = this->range(i);
+      if (range.begin_index() >= lastTick) break;
+      size_type const rangeFirst = std::max(range.begin_index(), pos);
+      size_type const rangeLast = std::min(range.end_index(), lastTick);
+      iOut = std::fill_n(iOut, rangeFirst - pos, 0.0f);
+      iOut = std::copy(range.begin() + (rangeFirst - range.begin_index()),
+                       range.begin() + (rangeLast - range.begin_index()),
+                       iOut);
+      pos = rangeLast;
+    } // for
+    std::fill(iOut, out.end(), 0.0f);
+  } // WireBlock::ChannelView::FillSignal(size_type)
+
+  //----------------------------------------------------------------------
+  WireBlock::RegionsOfInterest_t WireBlock::ChannelView::MakeSignalROI() const
+  {
+    RegionsOfInterest_t signal(NSignal());
+    for (size_type i = 0; i < n_ranges(); ++i) {
+      RangeView const range = this->range(i);
+      signal.add_range(range.begin_index(), range.begin(), range.end());
+    }
+    return signal;
+  } // WireBlock::ChannelView::MakeSignalROI()
+
+  //----------------------------------------------------------------------
+  recob::Wire WireBlock::ChannelView::MakeWire() const
+  {
+    return {MakeSignalROI(), Channel(), View()};
+  } // WireBlock::ChannelView::MakeWire()
+
+  //----------------------------------------------------------------------
+  float WireBlock::ChannelView::operator[](size_type index) const
+  {
+    size_type const r = findRange(index);
+    if (r == rangeEnd()) return 0.0f;
+    RangeView const range = this->range(r - rangeBegin());
+    return range.includes(index) ? range[index] : 0.0f;
+  } // WireBlock::ChannelView::operator[]()
+
+  //----------------------------------------------------------------------
+  bool WireBlock::ChannelView::is_void(size_type index) const
+  {
+    if (index >= size()) {
+      throw std::out_of_range("recob::WireBlock::ChannelView::is_void(): tick " +
+                              std::to_string(index) + " out of range");
+    }
+    size_type const r = findRange(index);
+    return (r == rangeEnd()) || !range(r - rangeBegin()).includes(index);
+  } // WireBlock::ChannelView::is_void()
+
+  //----------------------------------------------------------------------
+  WireBlock::size_type WireBlock::ChannelView::count() const
+  {
+    return fBlock->fSampleOffsets[rangeEnd()] - fBlock->fSampleOffsets[rangeBegin()];
+  } // WireBlock::ChannelView::count()
+
+  //----------------------------------------------------------------------
+  WireBlock::size_type WireBlock::ChannelView::findRange(size_type index) const
+  {
+    // the range after the one possibly including index...
+    auto const rbegin = fBlock->fRangeBegins.begin();
+    size_type const next =
+      std::upper_bound(rbegin + rangeBegin(), rbegin + rangeEnd(), index) - rbegin;
+    if (next == rangeBegin()) return next;
+    // ... and the one before it, unless it ends before index
+    return (range(next - 1 - rangeBegin()).end_index() > index) ? next - 1 : next;
+  } // WireBlock::ChannelView::findRange()
+
+} // namespace recob
@@ -0,0 +1,289 @@
+/** ****************************************************************************
+ * @file lardataobj/RecoBase/WireBlock.h
+ * @brief Declaration of a columnar collection of channel signals.
+ * @see  lardataobj/RecoBase/WireBlock.cxx
+ */
+
+#ifndef LARDATAOBJ_RECOBASE_WIREBLOCK_H
+#define LARDATAOBJ_RECOBASE_WIREBLOCK_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "lardataobj/RecoBase/Wire.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <ranges>  // std::views
+#include <span>
+#include <vector>
+
+namespace recob {
+
+  /**
+   * @brief Regions of interest of the signal from many channels, by column.
+   * @see `recob::Wire`
+   *
+   * This object holds the same information as a collection of `recob::Wire`,
+   * typically all the channels of an event, with a columnar layout: the
+   * information of each channel (ID, view, number of ticks), of each region of
+   * interest (first tick, location of its samples) and the samples themselves
+   * are each stored in a single array.
+   * Compared to `std::vector<recob::Wire>`, where each channel has its own
+   * list of regions and each region its own vector of samples, this requires
+   * a handful of allocations for the whole event, is faster to read and write,
+   * and lets algorithms run over the signal of many channels in sequence.
+   *
+   * The content of a single channel is accessed via a `ChannelView` object,
+   * which offers the reading interface of the regions of interest of a
+   * `recob::Wire` (`recob::Wire::SignalROI()`):
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * for (std::size_t i = 0; i < block.NChannels(); ++i) {
+   *   recob::WireBlock::ChannelView const channel = block[i];
+   *   for (auto const& ROI: channel.get_ranges()) {
+   *     const int FirstTick = ROI.begin_index();
+   *     for (float ADC: ROI) // ...
+   *   }
+   * }
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Conversion from and to `recob::Wire` collections is provided by the
+   * constructor and by `ToWires()` respectively.
+   *
+   * Channels are kept in the order they were added.
+   */
+  class WireBlock {
+  public:
+    using RegionsOfInterest_t = recob::Wire::RegionsOfInterest_t;
+    using size_type = std::size_t;
+
+    class RangeView;
+    class ChannelView;
+
+    /// Default constructor: no channels.
+    WireBlock() = default;
+
+    /// Constructor: copies the content of the specified wires, in order.
+    explicit WireBlock(std::vector<recob::Wire> const& wires);
+
+    // --- BEGIN -- Filling --------------------------------------------------
+    /// @name Filling
+    /// @{
+
+    /**
+       * @brief Prepares memory for the specified amount of data.
+       * @param nChannels number of channels
+       * @param nRanges total number of regions of interest
+       * @param nSamples total number of samples in the regions of interest
+       */
+    void Reserve(size_type nChannels, size_type nRanges, size_type nSamples);
+
+    /// Appends a channel with the specified regions of interest.
+    void AddChannel(raw::ChannelID_t channel, geo::View_t view, RegionsOfInterest_t const& signal);
+
+    /// Appends the content of a wire.
+    void AddWire(recob::Wire const& wire);
+
+    /// @}
+    // --- END -- Filling ----------------------------------------------------
+
+    // --- BEGIN -- Accessors ------------------------------------------------
+    /// @name Accessors
+    /// @{
+
+    /// Returns the number of channels.
+    size_type NChannels() const { return fChannels.size(); }
+
+    /// Returns whether there are no channels.
+    bool empty() const { return fChannels.empty(); }
+
+    /// Returns the total number of regions of interest.
+    size_type NRanges() const { return fRangeBegins.size(); }
+
+    /// Returns the total number of samples in the regions of interest.
+    size_type NSamples() const { return fSamples.size(); }
+
+    /// Returns the view of the channel with the specified index (no check).
+    ChannelView operator[](size_type index) const;
+
+    /// Returns the view of the channel with the specified index.
+    /// @throw std::out_of_range if `index` is not smaller than `NChannels()`
+    ChannelView at(size_type index) const;
+
+    /// Returns the IDs of all the channels.
+    std::span<raw::ChannelID_t const> ChannelIDs() const { return fChannels; }
+
+    /// Returns the views of all the channels.
+    std::span<geo::View_t const> Views() const { return fViews; }
+
+    /// Returns all the samples of all the regions of interest, in order.
+    std::span<float const> Samples() const { return fSamples; }
+
+    /// @}
+    // --- END -- Accessors --------------------------------------------------
+
+    /// Returns the content as a collection of `recob::Wire`, in order.
+    std::vector<recob::Wire> ToWires() const;
+
+  private:
+    std::vector<raw::ChannelID_t> fChannels; ///< ID of each channel.
+    std::vector<geo::View_t> fViews;         ///< View of each channel.
+    std::vector<size_type> fNSignal;         ///< Number of ticks in each channel.
+
+    /// Index of the first region of each channel; one extra entry at the end.
+    std::vector<size_type> fRangeOffsets{0};
+
+    std::vector<size_type> fRangeBegins; ///< First tick of each region.
+
+    /// Index in `fSamples` of the first sample of each region; one extra entry.
+    std::vector<size_type> fSampleOffsets{0};
+
+    std::vector<float> fSamples; ///< Samples of all regions, in order.
+
+  }; // class WireBlock
+
+  //----------------------------------------------------------------------------
+  /// Read-only view of a region of interest in a `recob::WireBlock`.
+  class WireBlock::RangeView {
+  public:
+    using const_iterator = float const*;
+    using iterator = const_iterator;
+
+    RangeView(size_type begin, std::span<float const> samples)
+      : fBegin(begin), fSamples(samples)
+    {}
+
+    /// Returns the first tick of the region.
+    size_type begin_index() const { return fBegin; }
+
+    /// Returns the tick after the last one of the region.
+    size_type end_index() const { return fBegin + size(); }
+
+    /// Returns the number of ticks in the region.
+    size_type size() const { return fSamples.size(); }
+
+    /// Returns whether the specified absolute tick is in this region.
+    bool includes(size_type index) const
+    {
+      return (index >= begin_index()) && (index < end_index());
+    }
+
+    /// Returns the sample at the specified absolute tick (no check!).
+    float operator[](size_type index) const { return fSamples[index - fBegin]; }
+
+    /// Returns the samples of the region.
+    std::span<float const> data() const { return fSamples; }
+
+    const_iterator begin() const { return fSamples.data(); }
+    const_iterator end() const { return fSamples.data() + fSamples.size(); }
+
+  private:
+    size_type fBegin;                ///< First tick of the region.
+    std::span<float const> fSamples; ///< Samples of the region.
+
+  }; // class WireBlock::RangeView
+
+  //----------------------------------------------------------------------------
+  /**
+   * @brief Read-only view of a channel in a `recob::WireBlock`.
+   *
+   * The view supports the reading interface of `recob::Wire` (`Channel()`,
+   * `View()`, `NSignal()`, `Signal()`, `FillSignal()`) and of its regions of
+   * interest (`size()`, `n_ranges()`, `range()`, `get_ranges()`,
+   * `operator[]`, `is_void()`, `count()`), with ranges represented as
+   * `RangeView` objects.
+   * A `recob::Wire` with the same content is returned by `MakeWire()`.
+   *
+   * The view is invalidated when the `WireBlock` it refers to is changed or
+   * destroyed.
+   */
+  class WireBlock::ChannelView {
+  public:
+    ChannelView(WireBlock const& block, size_type index) : fBlock(&block), fIndex(index) {}
+
+    // --- BEGIN -- Channel information ----------------------------------------
+    /// Returns the ID of the channel.
+    raw::ChannelID_t Channel() const { return fBlock->fChannels[fIndex]; }
+
+    /// Returns the view the channel belongs to.
+    geo::View_t View() const { return fBlock->fViews[fIndex]; }
+
+    /// Returns the number of time ticks, or samples, in the channel.
+    size_type NSignal() const { return fBlock->fNSignal[fIndex]; }
+
+    /// Returns a zero-padded full length vector filled with the signal.
+    std::vector<float> Signal() const;
+
+    /// Writes the zero-padded full signal into `out` (see `Wire::FillSignal()`).
+    void FillSignal(std::span<float> out) const;
+
+    /// Writes the zero-padded signal from `firstTick` on into `out`.
+    void FillSignal(std::span<float> out, size_type firstTick) const;
+
+    /// Returns a new sparse vector with the regions of interest.
+    RegionsOfInterest_t MakeSignalROI() const;
+
+    /// Returns a new `recob::Wire` with the content of this channel.
+    recob::Wire MakeWire() const;
+    // --- END -- Channel information ------------------------------------------
+
+    // --- BEGIN -- Regions of interest ----------------------------------------
+    /// Returns the number of ticks in the channel.
+    size_type size() const { return NSignal(); }
+
+    /// Returns the number of regions of interest.
+    size_type n_ranges() const { return rangeEnd() - rangeBegin(); }
+
+    /// Returns the `i`-th region of interest (no check).
+    RangeView range(size_type i) const;
+
+    /// Returns an iterable object over all the regions of interest.
+    auto get_ranges() const
+    {
+      return std::views::iota(size_type{0}, n_ranges()) |
+             std::views::transform([view = *this](size_type i) { return view.range(i); });
+    }
+
+    /// Returns the value at the specified tick (`0` if void; no range check).
+    float operator[](size_type index) const;
+
+    /// Returns whether the specified tick is not in any region of interest.
+    /// @throw std::out_of_range if `index` is not smaller than `size()`
+    bool is_void(size_type index) const;
+
+    /// Returns the number of ticks in the regions of interest.
+    size_type count() const;
+    // --- END -- Regions of interest ------------------------------------------
+
+  private:
+    WireBlock const* fBlock; ///< The block this view refers to.
+    size_type fIndex;        ///< Index of the channel in the block.
+
+    size_type rangeBegin() const { return fBlock->fRangeOffsets[fIndex]; }
+    size_type rangeEnd() const { return fBlock->fRangeOffsets[fIndex + 1]; }
+
+    /// Returns the block index of the first range ending after `index`,
+    /// or `rangeEnd()` if none.
+    size_type findRange(size_type index) const;
+
+  }; // class WireBlock::ChannelView
+
+} // namespace recob
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline recob::WireBlock::ChannelView recob::WireBlock::operator[](size_type index) const
+{
+  return {*this, index};
+}
+
+inline recob::WireBlock::RangeView recob::WireBlock::ChannelView::range(size_type i) const
+{
+  size_type const r = rangeBegin() + i;
+  std::span<float const> const samples{fBlock->fSamples};
+  return {fBlock->fRangeBegins[r],
+          samples.subspan(fBlock->fSampleOffsets[r],
+                          fBlock->fSampleOffsets[r + 1] - fBlock->fSampleOffsets[r])};
+}
+
+#endif // LARDATAOBJ_RECOBASE_WIREBLOCK_H
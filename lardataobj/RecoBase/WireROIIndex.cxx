@@ -0,0 +1,167 @@
+/** ****************************************************************************
+ * @file WireROIIndex.cxx
+ * @brief Index of the regions of interest of a collection of wires.
+ * @see  WireROIIndex.h
+ *
+ * ****************************************************************************/
+
+#include "lardataobj/RecoBase/WireROIIndex.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::stable_sort(), std::max(), std::upper_bound()
+#include <numeric>   // std::iota()
+#include <tuple>     // std::tie()
+#include <utility>   // std::move()
+
+namespace recob {
+
+  //----------------------------------------------------------------------
+  WireROIIndex::WireROIIndex(std::vector<recob::Wire> const& wires)
+  {
+    // channels are first recorded in the order of the wires...
+    std::vector<size_type> channelWires;
+    fChannels.reserve(wires.size());
+    channelWires.reserve(wires.size());
+    for (size_type iWire = 0; iWire < wires.size(); ++iWire) {
+      recob::Wire const& wire = wires[iWire];
+      size_type const n = wire.SignalROI().n_ranges();
+      if (n == 0) continue;
+      fChannels.push_back({wire.View(), wire.Channel(), 0, n});
+      channelWires.push_back(iWire);
+    }
+
+    // ... then sorted by view and ID...
+    std::vector<size_type> order(fChannels.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](size_type a, size_type b) {
+      return std::tie(fChannels[a].view, fChannels[a].channel) <
+             std::tie(fChannels[b].view, fChannels[b].channel);
+    });
+
+    // ... and their regions are laid out in that order
+    std::vector<ChannelInfo_t> channels;
+    channels.reserve(fChannels.size());
+    for (size_type const iChannel : order) {
+      ChannelInfo_t info = fChannels[iChannel];
+      size_type const iWire = channelWires[iChannel];
+      info.firstROI = fROIs.size();
+      size_type iRange = 0;
+      for (auto const& range : wires[iWire].SignalROI().get_ranges()) {
+        fROIs.push_back({info.channel, iWire, iRange++, range.begin_index(), range.end_index()});
+      }
+      info.endROI = fROIs.size();
+      channels.push_back(info);
+    }
+    fChannels = std::move(channels);
+
+    // interval tree of the regions of each view
+    fTree.reserve(fROIs.size());
+    fSortedEnds.reserve(fROIs.size());
+    for (size_type iChannel = 0; iChannel < fChannels.size();) {
+      ViewInfo_t view{fChannels[iChannel].view, iChannel, iChannel, fTree.size(), fTree.size()};
+      while ((iChannel < fChannels.size()) && (fChannels[iChannel].view == view.view))
+        ++iChannel;
+      view.endChannel = iChannel;
+      view.endROI = fChannels[iChannel - 1].endROI;
+
+      for (size_type position = view.firstROI; position < view.endROI; ++position) {
+        ROI_t const& roi = fROIs[position];
+        fTree.push_back({roi.begin, roi.end, roi.end, position});
+        fSortedEnds.push_back(roi.end);
+      }
+      std::sort(fTree.begin() + view.firstROI,
+                fTree.end(),
+                [](TreeNode_t const& a, TreeNode_t const& b) {
+                  return std::tie(a.begin, a.position) < std::tie(b.begin, b.position);
+                });
+      std::sort(fSortedEnds.begin() + view.firstROI, fSortedEnds.end());
+      buildTree(view.firstROI, view.endROI);
+
+      fViews.push_back(view);
+    } // for channels
+
+  } // WireROIIndex::WireROIIndex()
+
+  //----------------------------------------------------------------------
+  std::vector<WireROIIndex::ROI_t> WireROIIndex::Overlapping(raw::ChannelID_t c0,
+                                                             raw::ChannelID_t c1,
+                                                             size_type t0,
+                                                             size_type t1) const
+  {
+    std::vector<ROI_t> ROIs;
+    ForEachOverlapping(c0, c1, t0, t1, [&ROIs](ROI_t const& roi) { ROIs.push_back(roi); });
+    return ROIs;
+  } // WireROIIndex::Overlapping(channels)
+
+  //----------------------------------------------------------------------
+  std::vector<WireROIIndex::ROI_t> WireROIIndex::Overlapping(geo::View_t view,
+                                                             size_type t0,
+                                                             size_type t1) const
+  {
+    std::vector<ROI_t> ROIs;
+    ForEachOverlapping(view, t0, t1, [&ROIs](ROI_t const& roi) { ROIs.push_back(roi); });
+    return ROIs;
+  } // WireROIIndex::Overlapping(view)
+
+  //----------------------------------------------------------------------
+  auto WireROIIndex::countOverlapping(ViewInfo_t const& view, size_type t0, size_type t1) const
+    -> size_type
+  {
+    // the regions ending by t0 also start before t1, and they are not overlapping
+    auto const treeBegin = fTree.begin() + view.firstROI;
+    auto const endsBegin = fSortedEnds.begin() + view.firstROI;
+    size_type const nStartBefore =
+      std::partition_point(treeBegin,
+                           fTree.begin() + view.endROI,
+                           [t1](TreeNode_t const& node) { return node.begin < t1; }) -
+      treeBegin;
+    size_type const nEndBefore =
+      std::upper_bound(endsBegin, fSortedEnds.begin() + view.endROI, t0) - endsBegin;
+    return nStartBefore - nEndBefore;
+  } // WireROIIndex::countOverlapping()
+
+  //----------------------------------------------------------------------
+  void WireROIIndex::collectOverlapping(ViewInfo_t const& view,
+                                        size_type t0,
+                                        size_type t1,
+                                        size_type p0,
+                                        size_type p1,
+                                        std::vector<size_type>& positions) const
+  {
+    collectInTree(view.firstROI, view.endROI, t0, t1, positions);
+    std::erase_if(positions,
+                  [p0, p1](size_type position) { return (position < p0) || (position >= p1); });
+    std::sort(positions.begin(), positions.end());
+  } // WireROIIndex::collectOverlapping()
+
+  //----------------------------------------------------------------------
+  void WireROIIndex::collectInTree(size_type lo,
+                                   size_type hi,
+                                   size_type t0,
+                                   size_type t1,
+                                   std::vector<size_type>& positions) const
+  {
+    // the nodes are sorted by first tick, and the root of [lo, hi) is in the middle
+    if (lo >= hi) return;
+    size_type const mid = lo + (hi - lo) / 2;
+    TreeNode_t const& node = fTree[mid];
+    if (node.maxEnd <= t0) return; // no region in this subtree reaches t0
+    collectInTree(lo, mid, t0, t1, positions);
+    if (node.begin >= t1) return; // this and all later regions start after t1
+    if (node.end > t0) positions.push_back(node.position);
+    collectInTree(mid + 1, hi, t0, t1, positions);
+  } // WireROIIndex::collectInTree()
+
+  //----------------------------------------------------------------------
+  auto WireROIIndex::buildTree(size_type lo, size_type hi) -> size_type
+  {
+    if (lo >= hi) return 0;
+    size_type const mid = lo + (hi - lo) / 2;
+    TreeNode_t& node = fTree[mid];
+    node.maxEnd = std::max({node.end, buildTree(lo, mid), buildTree(mid + 1, hi)});
+    return node.maxEnd;
+  } // WireROIIndex::buildTree()
+
+  //----------------------------------------------------------------------
+
+} // namespace recob
@@ -0,0 +1,282 @@
+/** ****************************************************************************
+ * @file lardataobj/RecoBase/WireROIIndex.h
+ * @brief Index of the regions of interest of a collection of wires.
+ * @see  lardataobj/RecoBase/WireROIIndex.cxx
+ */
+
+#ifndef LARDATAOBJ_RECOBASE_WIREROIINDEX_H
+#define LARDATAOBJ_RECOBASE_WIREROIINDEX_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "lardataobj/RecoBase/Wire.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::lower_bound(), std::partition_point()
+#include <cstddef>   // std::size_t
+#include <vector>
+
+namespace recob {
+
+  /**
+   * @brief Index of the regions of interest of many channels by tick.
+   *
+   * The index is built once from a collection of `recob::Wire` and answers
+   * queries of the type "which regions of interest overlap the ticks
+   * `[t0, t1)` on the channels `[c0, c1)`" (or on all the channels of a view)
+   * without scanning all the wires and all their regions.
+   *
+   * Regions are grouped by channel, with channels sorted by view and ID.
+   * Each view also has an interval tree of its regions: the regions are
+   * sorted by their first tick in an implicit balanced binary tree, where
+   * each node also holds the largest end tick of its subtree.
+   * A query on a view can then be answered in one of two ways:
+   * * channel by channel: since the regions of a channel are sorted and do
+   *   not overlap, the first overlapping region of each channel is found by
+   *   binary search, in a time proportional to @f$ C \log R @f$, where
+   *   @f$ C @f$ is the number of channels with regions in the channel range
+   *   (including the ones with no region in the tick window) and @f$ R @f$
+   *   the number of regions in a channel;
+   * * via the interval tree: only the subtrees with regions reaching into the
+   *   tick window are visited, so channels without regions in the window are
+   *   skipped, in a time proportional to @f$ (1 + K_{v}) \log N @f$, where
+   *   @f$ N @f$ is the number of regions of the view and @f$ K_{v} @f$ the
+   *   ones overlapping the tick window on any channel of the view; the
+   *   regions found are then sorted by channel and tick, and the ones out of
+   *   the channel range discarded.
+   *
+   * @f$ K_{v} @f$ is counted with two binary searches before the query, and
+   * the way expected to be faster (the tree if @f$ K_{v} \le C @f$) is used.
+   *
+   * Each region is described by a `ROI_t` record, which includes the index
+   * of the wire in the original collection and of the region within the wire:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * recob::WireROIIndex const index{wires};
+   * for (recob::WireROIIndex::ROI_t const& roi: index.Overlapping(geo::kW, t0, t1)) {
+   *   auto const& range = wires[roi.wire].SignalROI().range(roi.range);
+   *   // ...
+   * }
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * The index does not refer to the wire collection after construction, but
+   * the indices it returns are meaningful only for that collection.
+   */
+  class WireROIIndex {
+  public:
+    using size_type = std::size_t;
+
+    /// Description of a region of interest in the index.
+    struct ROI_t {
+      raw::ChannelID_t channel; ///< ID of the channel of the region.
+      size_type wire;           ///< Index of the wire in the original collection.
+      size_type range;          ///< Index of the region within the wire.
+      size_type begin;          ///< First tick of the region.
+      size_type end;            ///< Tick after the last one of the region.
+    }; // ROI_t
+
+    /// Default constructor: an empty index.
+    WireROIIndex() = default;
+
+    /// Constructor: indexes all the regions of interest of `wires`.
+    explicit WireROIIndex(std::vector<recob::Wire> const& wires);
+
+    /// Returns the total number of indexed regions of interest.
+    size_type size() const { return fROIs.size(); }
+
+    /// Returns whether no region of interest is indexed.
+    bool empty() const { return fROIs.empty(); }
+
+    /**
+       * @brief Calls `op` on each region overlapping the specified window.
+       * @tparam Op type of callable object, taking a `ROI_t const&` argument
+       * @param c0 first channel of the window
+       * @param c1 channel after the last one of the window
+       * @param t0 first tick of the window
+       * @param t1 tick after the last one of the window
+       * @param op the operation to be called
+       *
+       * Regions are visited by view, then by channel, then by tick.
+       * When the interval tree is used, the regions found are collected in a
+       * temporary list before being visited.
+       */
+    template <typename Op>
+    void ForEachOverlapping(raw::ChannelID_t c0,
+                            raw::ChannelID_t c1,
+                            size_type t0,
+                            size_type t1,
+                            Op op) const;
+
+    /// Calls `op` on each region of `view` overlapping ticks `[t0, t1)`.
+    template <typename Op>
+    void ForEachOverlapping(geo::View_t view, size_type t0, size_type t1, Op op) const;
+
+    /// Returns all regions overlapping ticks `[t0, t1)` on channels `[c0, c1)`.
+    std::vector<ROI_t> Overlapping(raw::ChannelID_t c0,
+                                   raw::ChannelID_t c1,
+                                   size_type t0,
+                                   size_type t1) const;
+
+    /// Returns all regions of `view` overlapping ticks `[t0, t1)`.
+    std::vector<ROI_t> Overlapping(geo::View_t view, size_type t0, size_type t1) const;
+
+  private:
+    /// Information about a channel with regions of interest.
+    struct ChannelInfo_t {
+      geo::View_t view;         ///< View of the channel.
+      raw::ChannelID_t channel; ///< ID of the channel.
+      size_type firstROI;       ///< Index of the first region in `fROIs`.
+      size_type endROI;         ///< Index after the last region in `fROIs`.
+    }; // ChannelInfo_t
+
+    /// Information about a view with regions of interest.
+    struct ViewInfo_t {
+      geo::View_t view;       ///< The view.
+      size_type firstChannel; ///< Index of the first channel in `fChannels`.
+      size_type endChannel;   ///< Index after the last channel in `fChannels`.
+      size_type firstROI;     ///< Index of the first region in `fROIs` and `fTree`.
+      size_type endROI;       ///< Index after the last region in `fROIs` and `fTree`.
+    }; // ViewInfo_t
+
+    /// Node of the interval tree of a view.
+    struct TreeNode_t {
+      size_type begin;    ///< First tick of the region.
+      size_type end;      ///< Tick after the last one of the region.
+      size_type maxEnd;   ///< Largest `end` in the subtree of this node.
+      size_type position; ///< Index of the region in `fROIs`.
+    }; // TreeNode_t
+
+    std::vector<ViewInfo_t> fViews;       ///< Views, sorted.
+    std::vector<ChannelInfo_t> fChannels; ///< Channels, sorted by view and ID.
+    std::vector<ROI_t> fROIs;             ///< Regions, sorted by view and channel.
+
+    /// Regions of each view sorted by first tick, as implicit binary trees.
+    std::vector<TreeNode_t> fTree;
+
+    /// End ticks of the regions of each view, sorted.
+    std::vector<size_type> fSortedEnds;
+
+    /// Returns the number of regions of `view` overlapping `[t0, t1)`.
+    size_type countOverlapping(ViewInfo_t const& view, size_type t0, size_type t1) const;
+
+    /// Fills `positions` with the sorted indices of the regions of `view`
+    /// overlapping `[t0, t1)` from `fROIs`, in the range `[p0, p1)`.
+    void collectOverlapping(ViewInfo_t const& view,
+                            size_type t0,
+                            size_type t1,
+                            size_type p0,
+                            size_type p1,
+                            std::vector<size_type>& positions) const;
+
+    /// Adds the overlapping regions of the tree nodes `[lo, hi)` to `positions`.
+    void collectInTree(size_type lo,
+                       size_type hi,
+                       size_type t0,
+                       size_type t1,
+                       std::vector<size_type>& positions) const;
+
+    /// Sets `maxEnd` of the tree nodes `[lo, hi)`, and returns the largest.
+    size_type buildTree(size_type lo, size_type hi);
+
+    /// Calls `op` on the regions of channels `[first, last)` of `view`
+    /// overlapping `[t0, t1)`.
+    template <typename Op>
+    void forEachInChannels(ViewInfo_t const& view,
+                           size_type first,
+                           size_type last,
+                           size_type t0,
+                           size_type t1,
+                           Op& op) const;
+
+    /// Calls `op` on the regions of channel `info` overlapping `[t0, t1)`.
+    template <typename Op>
+    void forEachInChannel(ChannelInfo_t const& info, size_type t0, size_type t1, Op& op) const;
+
+  }; // class WireROIIndex
+
+} // namespace recob
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Op>
+void recob::WireROIIndex::ForEachOverlapping(raw::ChannelID_t c0,
+                                             raw::ChannelID_t c1,
+                                             size_type t0,
+                                             size_type t1,
+                                             Op op) const
+{
+  if ((c0 >= c1) || (t0 >= t1)) return;
+  for (ViewInfo_t const& view : fViews) {
+    auto const vbegin = fChannels.begin() + view.firstChannel;
+    auto const vend = fChannels.begin() + view.endChannel;
+    auto const byChannel = [](ChannelInfo_t const& info, raw::ChannelID_t channel) {
+      return info.channel < channel;
+    };
+    auto const first = std::lower_bound(vbegin, vend, c0, byChannel);
+    auto const last = std::lower_bound(first, vend, c1, byChannel);
+    forEachInChannels(view, first - fChannels.begin(), last - fChannels.begin(), t0, t1, op);
+  } // for views
+} // recob::WireROIIndex::ForEachOverlapping(channels)
+
+//------------------------------------------------------------------------------
+template <typename Op>
+void recob::WireROIIndex::ForEachOverlapping(geo::View_t view,
+                                             size_type t0,
+                                             size_type t1,
+                                             Op op) const
+{
+  if (t0 >= t1) return;
+  auto const itView = std::lower_bound(
+    fViews.begin(), fViews.end(), view, [](ViewInfo_t const& info, geo::View_t view) {
+      return info.view < view;
+    });
+  if ((itView == fViews.end()) || (itView->view != view)) return;
+  forEachInChannels(*itView, itView->firstChannel, itView->endChannel, t0, t1, op);
+} // recob::WireROIIndex::ForEachOverlapping(view)
+
+//------------------------------------------------------------------------------
+template <typename Op>
+void recob::WireROIIndex::forEachInChannels(ViewInfo_t const& view,
+                                            size_type first,
+                                            size_type last,
+                                            size_type t0,
+                                            size_type t1,
+                                            Op& op) const
+{
+  if (first >= last) return;
+
+  // the tree is used when it is expected to visit fewer nodes than channels
+  size_type const nOverlapping = countOverlapping(view, t0, t1);
+  if (nOverlapping == 0) return;
+  if (nOverlapping <= last - first) {
+    std::vector<size_type> positions;
+    positions.reserve(nOverlapping);
+    collectOverlapping(
+      view, t0, t1, fChannels[first].firstROI, fChannels[last - 1].endROI, positions);
+    for (size_type const position : positions)
+      op(fROIs[position]);
+  }
+  else {
+    for (size_type iChannel = first; iChannel < last; ++iChannel)
+      forEachInChannel(fChannels[iChannel], t0, t1, op);
+  }
+} // recob::WireROIIndex::forEachInChannels()
+
+//------------------------------------------------------------------------------
+template <typename Op>
+void recob::WireROIIndex::forEachInChannel(ChannelInfo_t const& info,
+                                           size_type t0,
+                                           size_type t1,
+                                           Op& op) const
+{
+  // regions of a channel are sorted and disjoint: the ends are sorted too
+  auto const end = fROIs.begin() + info.endROI;
+  auto it = std::partition_point(
+    fROIs.begin() + info.firstROI, end, [t0](ROI_t const& roi) { return roi.end <= t0; });
+  for (; (it != end) && (it->begin < t1); ++it)
+    op(*it);
+} // recob::WireROIIndex::forEachInChannel()
+
+//------------------------------------------------------------------------------
+
+#endif // LARDATAOBJ_RECOBASE_WIREROIINDEX_H
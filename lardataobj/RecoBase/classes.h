@@ -8,10 +8,13 @@
 #include "lardataobj/RawData/RDTimeStamp.h"
 #include "lardataobj/RawData/RawDigit.h"
 #include "lardataobj/RecoBase/Cluster.h"
+#include "lardataobj/RecoBase/CompactWire.h"
 #include "lardataobj/RecoBase/Edge.h"
 #include "lardataobj/RecoBase/EndPoint2D.h"
 #include "lardataobj/RecoBase/Event.h"
 #include "lardataobj/RecoBase/Hit.h"
+#include "lardataobj/RecoBase/HitColumns.h"
+#include "lardataobj/RecoBase/HitLite.h"
 #include "lardataobj/RecoBase/MCSFitResult.h"
 #include "lardataobj/RecoBase/OpFlash.h"
 #include "lardataobj/RecoBase/OpHit.h"
@@ -24,6 +27,7 @@
 #include "lardataobj/RecoBase/Shower.h"
 #include "lardataobj/RecoBase/Slice.h"
 #include "lardataobj/RecoBase/SpacePoint.h"
+#include "lardataobj/RecoBase/SparseVectorStreamer.h"
 #include "lardataobj/RecoBase/Track.h"
 #include "lardataobj/RecoBase/TrackFitHitInfo.h"
 #include "lardataobj/RecoBase/TrackHitMeta.h"
@@ -32,3 +36,20 @@
 #include "lardataobj/RecoBase/Vertex.h"
 #include "lardataobj/RecoBase/VertexAssnMeta.h"
 #include "lardataobj/RecoBase/Wire.h"
+#include "lardataobj/RecoBase/WireBlock.h"
+#include "lardataobj/Utilities/sparse_vector.h"
+
+#include "TGenericClassInfo.h"
+
+// the class information is a function-local static created on the first call,
+// so the streamer can be attached here regardless of the initialization order
+namespace ROOT {
+  TGenericClassInfo* GenerateInitInstance(lar::sparse_vector<float> const*);
+}
+
+namespace {
+  // reading `lar::sparse_vector<float>` in packed form needs no installation
+  [[maybe_unused]] Short_t const SparseVectorStreamerRegistered =
+    ROOT::GenerateInitInstance(static_cast<lar::sparse_vector<float> const*>(nullptr))
+      ->AdoptStreamer(lar::MakeSparseVectorStreamer());
+}
@@ -0,0 +1,131 @@
+/**
+ * @file   lardataobj/Simulation/CompactSimChannel.cxx
+ * @brief  Simulated channel information in a flat (compressed sparse row) layout.
+ * @see    CompactSimChannel.h
+ */
+
+#include "lardataobj/Simulation/CompactSimChannel.h"
+
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::lower_bound(), std::upper_bound()
+#include <utility> // std::move()
+
+namespace sim {
+
+  //-------------------------------------------------
+  CompactSimChannel::CompactSimChannel() : fChannel(raw::InvalidChannelID), fOffsets{0} {}
+
+  //-------------------------------------------------
+  CompactSimChannel::CompactSimChannel(SimChannel const& simChannel)
+    : fChannel(simChannel.Channel())
+  {
+    auto const& tdcIDEs = simChannel.TDCIDEMap();
+
+    std::size_t nIDEs = 0;
+    for (auto const& tdcIDE : tdcIDEs)
+      nIDEs += tdcIDE.second.size();
+
+    fTDCs.reserve(tdcIDEs.size());
+    fOffsets.reserve(tdcIDEs.size() + 1);
+    fIDEs.reserve(nIDEs);
+
+    fOffsets.push_back(0);
+    for (auto const& [tdc, ides] : tdcIDEs) {
+      fTDCs.push_back(tdc);
+      fIDEs.insert(fIDEs.end(), ides.begin(), ides.end());
+      fOffsets.push_back(fIDEs.size());
+    }
+  } // CompactSimChannel::CompactSimChannel(SimChannel)
+
+  //-------------------------------------------------
+  double CompactSimChannel::Charge(TDC_t tdc) const
+  {
+    double charge = 0.;
+    std::size_t const i = findClosestTDC(tdc);
+    if ((i < NTDCs()) && (fTDCs[i] == tdc)) {
+      for (sim::IDE const& ide : TDCIDE(i).second)
+        charge += ide.numElectrons;
+    }
+    return charge;
+  } // CompactSimChannel::Charge()
+
+  //-------------------------------------------------
+  double CompactSimChannel::Energy(TDC_t tdc) const
+  {
+    double energy = 0.;
+    std::size_t const i = findClosestTDC(tdc);
+    if ((i < NTDCs()) && (fTDCs[i] == tdc)) {
+      for (sim::IDE const& ide : TDCIDE(i).second)
+        energy += ide.energy;
+    }
+    return energy;
+  } // CompactSimChannel::Energy()
+
+  //-----------------------------------------------------------------------
+  // the start and end tdc values are assumed to be inclusive
+  std::vector<sim::IDE> CompactSimChannel::TrackIDsAndEnergies(TDC_t startTDC, TDC_t endTDC) const
+  {
+    std::vector<sim::IDE> ides;
+    TrackIDsAndEnergies(startTDC, endTDC, ides);
+    return ides;
+  } // CompactSimChannel::TrackIDsAndEnergies()
+
+  //-----------------------------------------------------------------------
+  void CompactSimChannel::TrackIDsAndEnergies(TDC_t startTDC,
+                                              TDC_t endTDC,
+                                              std::vector<sim::IDE>& ides) const
+  {
+    ides.clear();
+
+    if (startTDC > endTDC) {
+      mf::LogWarning("CompactSimChannel")
+        << "requested tdc range is bogus: " << startTDC << " " << endTDC << " return empty vector";
+      return;
+    }
+
+    // all the deposits in the window are contiguous
+    auto const beginTDC = fTDCs.begin() + findClosestTDC(startTDC);
+    auto const endTDCs = std::upper_bound(beginTDC, fTDCs.end(), endTDC);
+    std::size_t const first = fOffsets[beginTDC - fTDCs.begin()];
+    std::size_t const last = fOffsets[endTDCs - fTDCs.begin()];
+
+    for (std::size_t i = first; i < last; ++i)
+      details::AddToTrackIDEs(ides, fIDEs[i]);
+  } // CompactSimChannel::TrackIDsAndEnergies(vector)
+
+  //-----------------------------------------------------------------------
+  std::vector<sim::TrackIDE> CompactSimChannel::TrackIDEs(TDC_t startTDC, TDC_t endTDC) const
+  {
+    std::vector<sim::TrackIDE> trackIDEs;
+
+    if (startTDC > endTDC) {
+      mf::LogWarning("CompactSimChannel::TrackIDEs")
+        << "requested tdc range is bogus: " << startTDC << " " << endTDC << " return empty vector";
+      return trackIDEs;
+    }
+
+    details::FillTrackIDEs(TrackIDsAndEnergies(startTDC, endTDC), trackIDEs);
+    return trackIDEs;
+  } // CompactSimChannel::TrackIDEs()
+
+  //-------------------------------------------------
+  SimChannel CompactSimChannel::MakeSimChannel() const
+  {
+    SimChannel::TDCIDEs_t tdcIDEs;
+    tdcIDEs.reserve(NTDCs());
+    for (auto const& [tdc, ides] : TDCIDEMap())
+      tdcIDEs.emplace_back(tdc, std::vector<sim::IDE>(ides.begin(), ides.end()));
+    return SimChannel{fChannel, std::move(tdcIDEs)};
+  } // CompactSimChannel::MakeSimChannel()
+
+  //-------------------------------------------------
+  std::size_t CompactSimChannel::findClosestTDC(StoredTDC_t tdc) const
+  {
+    return std::lower_bound(fTDCs.begin(), fTDCs.end(), tdc) - fTDCs.begin();
+  }
+
+  //-------------------------------------------------
+
+} // namespace sim
@@ -0,0 +1,196 @@
+/**
+ * @file   lardataobj/Simulation/CompactSimChannel.h
+ * @brief  Simulated channel information in a flat (compressed sparse row) layout.
+ * @see    CompactSimChannel.cxx
+ */
+
+#ifndef LARDATAOBJ_SIMULATION_COMPACTSIMCHANNEL_H
+#define LARDATAOBJ_SIMULATION_COMPACTSIMCHANNEL_H
+
+// LArSoftObj libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "lardataobj/Simulation/SimChannel.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <iterator>
+#include <span>
+#include <utility> // std::pair
+#include <vector>
+
+namespace sim {
+
+  /**
+   * @brief Energy deposited on a readout channel, in a flat layout.
+   * @see `sim::SimChannel`
+   *
+   * This object holds the same information as a `sim::SimChannel`, but
+   * instead of a separate list of `sim::IDE` for each TDC tick it stores:
+   *  * the sorted list of the TDC ticks with some deposit;
+   *  * a list of offsets, one per TDC plus one, pointing to the first
+   *    `sim::IDE` of each TDC;
+   *  * a single list with all the `sim::IDE`, sorted by TDC.
+   *
+   * This saves one memory allocation per TDC, and is streamed by ROOT in
+   * three blocks regardless of the number of TDC ticks.
+   *
+   * The object is read-only: it is created from a complete `sim::SimChannel`,
+   * and it can be converted back with `MakeSimChannel()`.
+   * The interface mirrors the query interface of `sim::SimChannel`, and the
+   * results are the same.
+   * `TDCIDEMap()` returns a range of pairs, each with the TDC tick (`first`)
+   * and a span of the `sim::IDE` in that tick (`second`):
+   * @code
+   * for (auto const& [ tdc, ides ]: compactSimChannel.TDCIDEMap()) {
+   *   for (sim::IDE const& ide: ides) { ... }
+   * }
+   * @endcode
+   */
+  class CompactSimChannel {
+  public:
+    /// Type for TDC tick used in the internal representation.
+    using StoredTDC_t = SimChannel::StoredTDC_t;
+
+    /// Type for TDC tick used in the interface.
+    using TDC_t = SimChannel::TDC_t;
+
+    /// Type of track ID (the value comes from Geant4).
+    using TrackID_t = SimChannel::TrackID_t;
+
+    /// Type of the energy deposits of a single TDC tick (TDC and IDE list).
+    using TDCIDEView_t = std::pair<StoredTDC_t, std::span<sim::IDE const>>;
+
+    class TDCIDERange_t; // forward declaration
+
+    /// Default constructor: no channel, no deposits.
+    CompactSimChannel();
+
+    /// Constructor: copies the content of the specified channel.
+    explicit CompactSimChannel(SimChannel const& simChannel);
+
+    /// Returns the readout channel this object describes.
+    raw::ChannelID_t Channel() const { return fChannel; }
+
+    /// Returns the number of TDC ticks with some deposit.
+    std::size_t NTDCs() const { return fTDCs.size(); }
+
+    /// Returns the total number of energy deposits (`sim::IDE`).
+    std::size_t NIDEs() const { return fIDEs.size(); }
+
+    /// Returns the sorted list of all TDC ticks with some deposit.
+    std::span<StoredTDC_t const> TDCs() const { return fTDCs; }
+
+    /// Returns all the energy deposits, sorted by TDC.
+    std::span<sim::IDE const> IDEs() const { return fIDEs; }
+
+    /// Returns the TDC and the deposits of the `i`-th TDC with signal (no check).
+    TDCIDEView_t TDCIDE(std::size_t i) const
+    {
+      return {fTDCs[i], {fIDEs.data() + fOffsets[i], fIDEs.data() + fOffsets[i + 1]}};
+    }
+
+    /**
+     * @brief Returns all the deposited energy information
+     * @return a range of `TDCIDEView_t`, sorted by increasing TDC tick
+     * @see `sim::SimChannel::TDCIDEMap()`
+     */
+    TDCIDERange_t TDCIDEMap() const;
+
+    /// Returns the total number of ionization electrons on this channel in the specified TDC
+    double Charge(TDC_t tdc) const;
+
+    /// Returns the total energy on this channel in the specified TDC [MeV]
+    double Energy(TDC_t tdc) const;
+
+    /// Returns the energy deposited by each track within a time interval.
+    /// @see `sim::SimChannel::TrackIDsAndEnergies()`
+    std::vector<sim::IDE> TrackIDsAndEnergies(TDC_t startTDC, TDC_t endTDC) const;
+
+    /// Fills `ides` with the energy deposited by each track within a time interval.
+    /// @see `sim::SimChannel::TrackIDsAndEnergies()`
+    void TrackIDsAndEnergies(TDC_t startTDC, TDC_t endTDC, std::vector<sim::IDE>& ides) const;
+
+    /// Returns energies collected for each track within a time interval.
+    /// @see `sim::SimChannel::TrackIDEs()`
+    std::vector<sim::TrackIDE> TrackIDEs(TDC_t startTDC, TDC_t endTDC) const;
+
+    /// Returns a new `sim::SimChannel` with the content of this object.
+    SimChannel MakeSimChannel() const;
+
+    /// Comparison: sorts by channel ID
+    bool operator<(CompactSimChannel const& other) const { return fChannel < other.Channel(); }
+
+  private:
+    raw::ChannelID_t fChannel;      ///< readout channel where electrons are collected
+    std::vector<StoredTDC_t> fTDCs; ///< TDC ticks with signal, sorted
+
+    /// Index in `fIDEs` of the first deposit of each TDC; one extra entry.
+    std::vector<unsigned int> fOffsets;
+
+    std::vector<sim::IDE> fIDEs; ///< all deposits, sorted by TDC
+
+    /// Returns the index of the first TDC not earlier than `tdc`.
+    std::size_t findClosestTDC(StoredTDC_t tdc) const;
+
+  }; // class CompactSimChannel
+
+  /// Range of the deposits of all TDC ticks (see `CompactSimChannel::TDCIDEMap()`).
+  class CompactSimChannel::TDCIDERange_t {
+  public:
+    /// Iterator to the deposits of each TDC.
+    class const_iterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = TDCIDEView_t;
+      using difference_type = std::ptrdiff_t;
+      using pointer = void;
+      using reference = TDCIDEView_t;
+
+      const_iterator() = default;
+      const_iterator(CompactSimChannel const* channel, std::size_t index)
+        : fChannel(channel), fIndex(index)
+      {}
+
+      reference operator*() const { return fChannel->TDCIDE(fIndex); }
+
+      const_iterator& operator++()
+      {
+        ++fIndex;
+        return *this;
+      }
+
+      const_iterator operator++(int)
+      {
+        const_iterator const old{*this};
+        ++fIndex;
+        return old;
+      }
+
+      bool operator==(const_iterator const& other) const { return fIndex == other.fIndex; }
+      bool operator!=(const_iterator const& other) const { return fIndex != other.fIndex; }
+
+    private:
+      CompactSimChannel const* fChannel = nullptr; ///< channel being iterated
+      std::size_t fIndex = 0;                      ///< index of the current TDC
+    }; // class const_iterator
+
+    explicit TDCIDERange_t(CompactSimChannel const& channel) : fChannel(&channel) {}
+
+    const_iterator begin() const { return {fChannel, 0}; }
+    const_iterator end() const { return {fChannel, fChannel->NTDCs()}; }
+    std::size_t size() const { return fChannel->NTDCs(); }
+    bool empty() const { return size() == 0; }
+
+  private:
+    CompactSimChannel const* fChannel; ///< the channel with the deposits
+
+  }; // class CompactSimChannel::TDCIDERange_t
+
+} // namespace sim
+
+inline sim::CompactSimChannel::TDCIDERange_t sim::CompactSimChannel::TDCIDEMap() const
+{
+  return TDCIDERange_t{*this};
+}
+
+#endif // LARDATAOBJ_SIMULATION_COMPACTSIMCHANNEL_H
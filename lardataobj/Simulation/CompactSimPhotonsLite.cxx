@@ -0,0 +1,112 @@
+/**
+ * @file   lardataobj/Simulation/CompactSimPhotonsLite.cxx
+ * @brief  Detected photon counts on one optical channel, in flat arrays.
+ * @see    CompactSimPhotonsLite.h
+ */
+
+#include "lardataobj/Simulation/CompactSimPhotonsLite.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::lower_bound(), std::upper_bound(), std::equal()
+#include <numeric>   // std::accumulate()
+#include <utility>   // std::move()
+
+namespace sim {
+
+  //-------------------------------------------------
+  CompactSimPhotonsLite::CompactSimPhotonsLite(SimPhotonsLite const& photons)
+    : fOpChannel(photons.OpChannel)
+  {
+    fTimes.reserve(photons.DetectedPhotons.size());
+    fPhotons.reserve(photons.DetectedPhotons.size());
+    for (auto const& [time, nPhotons] : photons.DetectedPhotons) {
+      fTimes.push_back(time);
+      fPhotons.push_back(nPhotons);
+    }
+  } // CompactSimPhotonsLite::CompactSimPhotonsLite()
+
+  //-------------------------------------------------
+  int CompactSimPhotonsLite::Photons(int time) const
+  {
+    auto const itTime = std::lower_bound(fTimes.begin(), fTimes.end(), time);
+    if ((itTime == fTimes.end()) || (*itTime != time)) return 0;
+    return fPhotons[itTime - fTimes.begin()];
+  } // CompactSimPhotonsLite::Photons()
+
+  //-------------------------------------------------
+  int CompactSimPhotonsLite::PhotonsInRange(int startTime, int endTime) const
+  {
+    if (startTime > endTime) return 0;
+    auto const first = std::lower_bound(fTimes.begin(), fTimes.end(), startTime);
+    auto const last = std::upper_bound(first, fTimes.end(), endTime);
+    return std::accumulate(fPhotons.begin() + (first - fTimes.begin()),
+                           fPhotons.begin() + (last - fTimes.begin()),
+                           0);
+  } // CompactSimPhotonsLite::PhotonsInRange()
+
+  //-------------------------------------------------
+  int CompactSimPhotonsLite::TotalPhotons() const
+  {
+    return std::accumulate(fPhotons.begin(), fPhotons.end(), 0);
+  }
+
+  //-------------------------------------------------
+  SimPhotonsLite CompactSimPhotonsLite::MakeSimPhotonsLite() const
+  {
+    SimPhotonsLite photons{fOpChannel};
+    for (std::size_t i = 0; i < fTimes.size(); ++i)
+      photons.DetectedPhotons.emplace_hint(photons.DetectedPhotons.end(), fTimes[i], fPhotons[i]);
+    return photons;
+  } // CompactSimPhotonsLite::MakeSimPhotonsLite()
+
+  //-------------------------------------------------
+  CompactSimPhotonsLite& CompactSimPhotonsLite::operator+=(CompactSimPhotonsLite const& rhs)
+  {
+    // same ticks (e.g. adding to itself, or an empty `rhs`): plain sum of the counts
+    if ((fTimes.size() == rhs.fTimes.size()) &&
+        std::equal(fTimes.begin(), fTimes.end(), rhs.fTimes.begin())) {
+      for (std::size_t i = 0; i < fPhotons.size(); ++i)
+        fPhotons[i] += rhs.fPhotons[i];
+      return *this;
+    }
+
+    if (rhs.empty()) return *this;
+
+    // merge the two sorted lists of ticks
+    std::vector<int> times, photons;
+    times.reserve(fTimes.size() + rhs.fTimes.size());
+    photons.reserve(fTimes.size() + rhs.fTimes.size());
+    std::size_t i = 0, j = 0;
+    while ((i < fTimes.size()) && (j < rhs.fTimes.size())) {
+      if (fTimes[i] < rhs.fTimes[j]) {
+        times.push_back(fTimes[i]);
+        photons.push_back(fPhotons[i++]);
+      }
+      else if (rhs.fTimes[j] < fTimes[i]) {
+        times.push_back(rhs.fTimes[j]);
+        photons.push_back(rhs.fPhotons[j++]);
+      }
+      else {
+        times.push_back(fTimes[i]);
+        photons.push_back(fPhotons[i++] + rhs.fPhotons[j++]);
+      }
+    } // while
+    times.insert(times.end(), fTimes.begin() + i, fTimes.end());
+    photons.insert(photons.end(), fPhotons.begin() + i, fPhotons.end());
+    times.insert(times.end(), rhs.fTimes.begin() + j, rhs.fTimes.end());
+    photons.insert(photons.end(), rhs.fPhotons.begin() + j, rhs.fPhotons.end());
+
+    fTimes = std::move(times);
+    fPhotons = std::move(photons);
+    return *this;
+  } // CompactSimPhotonsLite::operator+=()
+
+  //-------------------------------------------------
+  CompactSimPhotonsLite CompactSimPhotonsLite::operator+(CompactSimPhotonsLite const& rhs) const
+  {
+    return CompactSimPhotonsLite(*this) += rhs;
+  }
+
+  //-------------------------------------------------
+
+} // namespace sim
@@ -0,0 +1,101 @@
+/**
+ * @file   lardataobj/Simulation/CompactSimPhotonsLite.h
+ * @brief  Detected photon counts on one optical channel, in flat arrays.
+ * @see    CompactSimPhotonsLite.cxx
+ */
+
+#ifndef LARDATAOBJ_SIMULATION_COMPACTSIMPHOTONSLITE_H
+#define LARDATAOBJ_SIMULATION_COMPACTSIMPHOTONSLITE_H
+
+// LArSoftObj libraries
+#include "lardataobj/Simulation/SimPhotons.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <span>
+#include <vector>
+
+namespace sim {
+
+  /**
+   * @brief Number of photons detected at each time on one optical channel.
+   *
+   * This object holds the same information as `sim::SimPhotonsLite`, where
+   * the photons at each time tick are stored in a `std::map`, i.e. one tree
+   * node per tick with photons.
+   * Here the ticks with photons are stored in a sorted array, and the number
+   * of photons at each of them in a parallel array of the same size.
+   * The photons in a time interval are then contiguous, and merging the
+   * photons of another object is a single linear pass on the two arrays.
+   *
+   * The ticks are not stored densely (one count per tick from the first to the
+   * last one), since the photons of a channel are often spread over a time
+   * much longer than the number of ticks with photons (e.g. late scintillation
+   * light).
+   *
+   * A `sim::CompactSimPhotonsLite` can be created from a `sim::SimPhotonsLite`
+   * and converted back with `MakeSimPhotonsLite()`.
+   * Like in `sim::SimPhotonsLite`, the ticks with photons added to them are
+   * kept even when the number of photons is `0`.
+   */
+  class CompactSimPhotonsLite {
+  public:
+    /// Default constructor (do not use! it's for ROOT only).
+    CompactSimPhotonsLite() = default;
+
+    /// Constructor: associated to optical detector channel `chan`, and empty.
+    explicit CompactSimPhotonsLite(int chan) : fOpChannel(chan) {}
+
+    /// Constructor: copies all the photons from `photons`.
+    explicit CompactSimPhotonsLite(SimPhotonsLite const& photons);
+
+    /// Returns the optical channel number this object is associated to.
+    int OpChannel() const { return fOpChannel; }
+
+    /// Returns the number of time ticks with photons.
+    std::size_t NTicks() const { return fTimes.size(); }
+
+    /// Returns whether there are no photons at all.
+    bool empty() const { return fTimes.empty(); }
+
+    /// Returns the sorted time ticks with photons.
+    std::span<int const> Times() const { return fTimes; }
+
+    /// Returns the number of photons at each of the ticks in `Times()`.
+    std::span<int const> Photons() const { return fPhotons; }
+
+    /// Returns the number of photons at time tick `time` (`0` if none).
+    int Photons(int time) const;
+
+    /// Returns the number of photons between two time ticks (both included).
+    int PhotonsInRange(int startTime, int endTime) const;
+
+    /// Returns the total number of photons.
+    int TotalPhotons() const;
+
+    /// Returns a `sim::SimPhotonsLite` with the same photons.
+    SimPhotonsLite MakeSimPhotonsLite() const;
+
+    /// Add all photons from `rhs` to this ones, at their original time.
+    CompactSimPhotonsLite& operator+=(CompactSimPhotonsLite const& rhs);
+
+    /// Creates a new `sim::CompactSimPhotonsLite` with all photons from `rhs`
+    /// and this object.
+    CompactSimPhotonsLite operator+(CompactSimPhotonsLite const& rhs) const;
+
+    /// Returns whether `other` is on the same channel (`OpChannel()`) as this.
+    bool operator==(CompactSimPhotonsLite const& other) const
+    {
+      return fOpChannel == other.fOpChannel;
+    }
+
+  private:
+    int fOpChannel = -1;       ///< optical detector channel associated to this data
+    std::vector<int> fTimes;   ///< time ticks with photons, sorted
+    std::vector<int> fPhotons; ///< number of photons at each tick in `fTimes`
+
+  }; // class CompactSimPhotonsLite
+
+} // namespace sim
+
+#endif // LARDATAOBJ_SIMULATION_COMPACTSIMPHOTONSLITE_H
@@ -10,7 +10,6 @@
 
 #include <algorithm> // std::lower_bound(), std::max()
 #include <limits>    // std::numeric_limits
-#include <map>
 #include <stdexcept>
 #include <utility>
 
@@ -46,6 +45,11 @@ namespace sim {
   //-------------------------------------------------
   OpDetBacktrackerRecord::OpDetBacktrackerRecord(int detNum) : iOpDetNum(detNum) {}
 
+  //-------------------------------------------------
+  OpDetBacktrackerRecord::OpDetBacktrackerRecord(int detNum, timePDclockSDPs_t&& timeSDPs)
+    : iOpDetNum(detNum), timePDclockSDPs(std::move(timeSDPs))
+  {}
+
   //-------------------------------------------------
   void OpDetBacktrackerRecord::AddScintillationPhotons(TrackID_t trackID,
                                                        timePDclock_t iTimePDclock,
@@ -122,7 +126,7 @@ namespace sim {
 
       // loop over the list for this iTimePDclock value and add up
       // the total number of electrons
-      for (auto sdp : itr->second) {
+      for (auto const& sdp : itr->second) {
         numPhotons += sdp.numPhotons;
       } // end loop over sim::SDP for this TimePDclock
 
@@ -144,7 +148,7 @@ namespace sim {
 
       // loop over the list for this iTimePDclock value and add up
       // the total number of photons
-      for (auto sdp : itr->second) {
+      for (auto const& sdp : itr->second) {
         energy += sdp.energy;
       } // end loop over sim::SDP for this TimePDclock
 
@@ -159,17 +163,25 @@ namespace sim {
     timePDclock_t startTimePDclock,
     timePDclock_t endTimePDclock) const
   {
-    // make a map of track ID values to sim::SDP objects
+    std::vector<sim::SDP> sdps;
+    TrackIDsAndEnergies(startTimePDclock, endTimePDclock, sdps);
+    return sdps;
+  }
+
+  //-----------------------------------------------------------------------
+  void OpDetBacktrackerRecord::TrackIDsAndEnergies(timePDclock_t startTimePDclock,
+                                                   timePDclock_t endTimePDclock,
+                                                   std::vector<sim::SDP>& sdps) const
+  {
+    sdps.clear();
 
     if (startTimePDclock > endTimePDclock) {
       mf::LogWarning("OpDetBacktrackerRecord")
         << "requested TimePDclock range is bogus: " << startTimePDclock << " " << endTimePDclock
         << " return empty vector";
-      return {}; // returns an empty vector
+      return;
     }
 
-    std::map<TrackID_t, sim::SDP> idToSDP;
-
     //find the lower bound for this iTimePDclock and then iterate from there
     auto itr = findClosestTimePDclockSDP(startTimePDclock);
 
@@ -179,41 +191,12 @@ namespace sim {
       // are outside the range
       if (itr->first > endTimePDclock) break;
 
-      // grab the vector of SDPs for this TimePDclock
-      auto const& sdplist = itr->second;
-      // now loop over them and add their content to the map
-      for (auto const& sdp : sdplist) {
-        auto itTrkSDP = idToSDP.find(sdp.trackID);
-        if (itTrkSDP != idToSDP.end()) {
-          // the SDP we are going to update:
-          sim::SDP& trackSDP = itTrkSDP->second;
-
-          double const nPh1 = trackSDP.numPhotons;
-          double const nPh2 = sdp.numPhotons;
-          double const weight = nPh1 + nPh2;
-
-          // make a weighted average for the location information
-          trackSDP.x = (sdp.x * nPh2 + trackSDP.x * nPh1) / weight;
-          trackSDP.y = (sdp.y * nPh2 + trackSDP.y * nPh1) / weight;
-          trackSDP.z = (sdp.z * nPh2 + trackSDP.z * nPh1) / weight;
-          trackSDP.numPhotons = weight;
-        } // end if the track id for this one is found
-        else {
-          idToSDP[sdp.trackID] = sim::SDP(sdp);
-        }
-      } // end loop over vector
+      // add all the SDPs for this TimePDclock to the list, sorted by track ID
+      for (auto const& sdp : itr->second)
+        details::AddToTrackSDPs(sdps, sdp);
 
       ++itr;
     } // end loop over iTimePDclock values
-
-    // now fill the vector with the sdps from the map
-    std::vector<sim::SDP> sdps;
-    sdps.reserve(idToSDP.size());
-    for (auto const& itr : idToSDP) {
-      sdps.push_back(itr.second);
-    }
-
-    return sdps;
   }
 
   //-----------------------------------------------------------------------
@@ -221,31 +204,30 @@ namespace sim {
   std::vector<sim::TrackSDP> OpDetBacktrackerRecord::TrackSDPs(timePDclock_t startTimePDclock,
                                                                timePDclock_t endTimePDclock) const
   {
-
     std::vector<sim::TrackSDP> trackSDPs;
+    std::vector<sim::SDP> sdps;
+    TrackSDPs(startTimePDclock, endTimePDclock, trackSDPs, sdps);
+    return trackSDPs;
+  }
+
+  //-----------------------------------------------------------------------
+  void OpDetBacktrackerRecord::TrackSDPs(timePDclock_t startTimePDclock,
+                                         timePDclock_t endTimePDclock,
+                                         std::vector<sim::TrackSDP>& trackSDPs,
+                                         std::vector<sim::SDP>& sdps) const
+  {
+    trackSDPs.clear();
+    sdps.clear();
 
     if (startTimePDclock > endTimePDclock) {
       mf::LogWarning("OpDetBacktrackerRecord::TrackSDPs")
         << "requested iTimePDclock range is bogus: " << startTimePDclock << " " << endTimePDclock
         << " return empty vector";
-      return trackSDPs;
-    }
-
-    double totalPhotons = 0.;
-    std::vector<sim::SDP> const sdps = TrackIDsAndEnergies(startTimePDclock, endTimePDclock);
-    for (auto const& sdp : sdps)
-      totalPhotons += sdp.numPhotons;
-
-    // protect against a divide by zero below
-    if (totalPhotons < 1.e-5) totalPhotons = 1.;
-
-    // loop over the entries in the map and fill the input vectors
-    for (auto const& sdp : sdps) {
-      if (sdp.trackID == sim::NoParticleId) continue;
-      trackSDPs.emplace_back(sdp.trackID, sdp.numPhotons / totalPhotons, sdp.numPhotons);
+      return;
     }
 
-    return trackSDPs;
+    TrackIDsAndEnergies(startTimePDclock, endTimePDclock, sdps);
+    details::FillTrackSDPs(sdps, trackSDPs);
   }
 
   //-----------------------------------------------------------------------
@@ -326,5 +308,52 @@ namespace sim {
   }
 
   //-------------------------------------------------
+  void details::AddToTrackSDPs(std::vector<sim::SDP>& trackSDPs, sim::SDP const& sdp)
+  {
+    // a sorted flat list: there are usually only a few tracks
+    auto itTrkSDP = std::lower_bound(
+      trackSDPs.begin(), trackSDPs.end(), sdp.trackID, [](sim::SDP const& a, SDP::TrackID_t id) {
+        return a.trackID < id;
+      });
+    if (itTrkSDP == trackSDPs.end() || itTrkSDP->trackID != sdp.trackID) {
+      trackSDPs.insert(itTrkSDP, sdp);
+      return;
+    }
+
+    // the SDP we are going to update:
+    sim::SDP& trackSDP = *itTrkSDP;
+
+    double const nPh1 = trackSDP.numPhotons;
+    double const nPh2 = sdp.numPhotons;
+    double const weight = nPh1 + nPh2;
+
+    // make a weighted average for the location information
+    trackSDP.x = (sdp.x * nPh2 + trackSDP.x * nPh1) / weight;
+    trackSDP.y = (sdp.y * nPh2 + trackSDP.y * nPh1) / weight;
+    trackSDP.z = (sdp.z * nPh2 + trackSDP.z * nPh1) / weight;
+    trackSDP.numPhotons = weight;
+  } // details::AddToTrackSDPs()
+
+  //-------------------------------------------------
+  void details::FillTrackSDPs(std::vector<sim::SDP> const& sdps,
+                              std::vector<sim::TrackSDP>& trackSDPs)
+  {
+    trackSDPs.clear();
+
+    double totalPhotons = 0.;
+    for (auto const& sdp : sdps)
+      totalPhotons += sdp.numPhotons;
+
+    // protect against a divide by zero below
+    if (totalPhotons < 1.e-5) totalPhotons = 1.;
+
+    // loop over the entries in the list and fill the input vectors
+    for (auto const& sdp : sdps) {
+      if (sdp.trackID == sim::NoParticleId) continue;
+      trackSDPs.emplace_back(sdp.trackID, sdp.numPhotons / totalPhotons, sdp.numPhotons);
+    }
+  } // details::FillTrackSDPs()
+
+  //-------------------------------------------------
 
 }
@@ -128,6 +128,16 @@ namespace sim {
     /// Constructor: immediately sets the Optical Detector number
     explicit OpDetBacktrackerRecord(int detNum);
 
+    /**
+     * @brief Constructor: sets the Optical Detector number and all the deposits
+     * @param detNum the Optical Detector number
+     * @param timePDclockSDPs the deposits for each time, sorted by time
+     *
+     * The times in `timePDclockSDPs` are expected to be sorted; this is not
+     * checked.
+     */
+    OpDetBacktrackerRecord(int detNum, timePDclockSDPs_t&& timePDclockSDPs);
+
     /**
      * @brief Add scintillation photons and energy to this OpticalDetector
      * @param trackID ID of simulated track depositing this energy (from Geant4)
@@ -136,6 +146,12 @@ namespace sim {
      * @param xyz coordinates of original location of ionization/scintillation (3D array) [cm]
      * @param energy energy deposited at this point by this track [MeV]
      *
+     * The photons are added to the existing time entry closest to
+     * `timePDclock` and not earlier than it, if any; otherwise a new entry is
+     * created at `timePDclock` rounded to the nanosecond.
+     * @note The distance from the existing entry is truncated to an integer
+     *       before being compared to 0.5 ns, so photons up to 1 ns before an
+     *       entry are added to it (e.g. at 10.3 ns to the entry at 11 ns).
      */
     void AddScintillationPhotons(TrackID_t trackID,
                                  timePDclock_t timePDclock,
@@ -166,6 +182,21 @@ namespace sim {
     std::vector<sim::SDP> TrackIDsAndEnergies(timePDclock_t startTimePDclock,
                                               timePDclock_t endTimePDclock) const;
 
+    /**
+     * @brief Fills the recorded energy deposition within a time interval
+     * @param startTimePDclock iTimePDclock tick opening the time window
+     * @param endTimePDclock iTimePDclock tick closing the time window (included in the interval)
+     * @param sdps the collection to be filled (previous content is removed)
+     * @see TrackIDsAndEnergies(timePDclock_t, timePDclock_t) const
+     *
+     * This is the same as `TrackIDsAndEnergies(timePDclock_t, timePDclock_t) const`,
+     * but the result is written into `sdps`. When the same `sdps` is reused
+     * for many calls (e.g. one per optical hit), its memory is reused as well.
+     */
+    void TrackIDsAndEnergies(timePDclock_t startTimePDclock,
+                             timePDclock_t endTimePDclock,
+                             std::vector<sim::SDP>& sdps) const;
+
     /**
      * @brief Returns all the deposited energy information as stored
      * @return all the deposited energy information as stored in the object
@@ -211,6 +242,26 @@ namespace sim {
     std::vector<sim::TrackSDP> TrackSDPs(timePDclock_t startTimePDclock,
                                          timePDclock_t endTimePDclock) const;
 
+    /**
+     * @brief Fills energies collected for each track within a time interval
+     * @param startTimePDclock iTimePDclock tick opening the time window
+     * @param endTimePDclock iTimePDclock tick closing the time window (included in the interval)
+     * @param trackSDPs the collection to be filled (previous content is removed)
+     * @param sdps buffer for the deposits of each track (previous content is removed)
+     * @see TrackSDPs(timePDclock_t, timePDclock_t) const
+     *
+     * This is the same as `TrackSDPs(timePDclock_t, timePDclock_t) const`, but
+     * the result is written into `trackSDPs`. The deposits of each track are
+     * collected in `sdps`, which on return holds the same as
+     * `TrackIDsAndEnergies(startTimePDclock, endTimePDclock)`.
+     * When the same `trackSDPs` and `sdps` are reused for many calls (e.g. one
+     * per optical hit), their memory is reused as well.
+     */
+    void TrackSDPs(timePDclock_t startTimePDclock,
+                   timePDclock_t endTimePDclock,
+                   std::vector<sim::TrackSDP>& trackSDPs,
+                   std::vector<sim::SDP>& sdps) const;
+
     /// Comparison: sorts by Optical Detector ID
     bool operator<(const OpDetBacktrackerRecord& other) const;
 
@@ -275,6 +326,33 @@ namespace sim {
       storedTimePDclock_t timePDclock) const;
   };
 
+  namespace details {
+
+    /**
+     * @brief Adds a deposit to a list of deposits per track
+     * @param trackSDPs list of deposits, one per track, sorted by track ID
+     * @param sdp the deposit to be added
+     *
+     * If `trackSDPs` already has a deposit from the track of `sdp`, `sdp` is
+     * merged into it (photons are added, the position is averaged with the
+     * number of photons as weight, and the energy is left unchanged);
+     * otherwise, a copy of `sdp` is inserted keeping the list sorted.
+     * This is the aggregation used by
+     * `sim::OpDetBacktrackerRecord::TrackIDsAndEnergies()`.
+     */
+    void AddToTrackSDPs(std::vector<sim::SDP>& trackSDPs, sim::SDP const& sdp);
+
+    /**
+     * @brief Fills a list of `sim::TrackSDP` from deposits aggregated by track
+     * @param sdps deposits, one per track (as from `AddToTrackSDPs()`)
+     * @param trackSDPs the list to be filled (previous content is removed)
+     *
+     * This is the conversion used by `sim::OpDetBacktrackerRecord::TrackSDPs()`.
+     */
+    void FillTrackSDPs(std::vector<sim::SDP> const& sdps, std::vector<sim::TrackSDP>& trackSDPs);
+
+  } // namespace details
+
 } // namespace sim
 
 inline bool sim::OpDetBacktrackerRecord::operator<(const sim::OpDetBacktrackerRecord& other) const
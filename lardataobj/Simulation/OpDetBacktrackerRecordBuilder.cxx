@@ -0,0 +1,169 @@
+/**
+ * @file   lardataobj/Simulation/OpDetBacktrackerRecordBuilder.cxx
+ * @brief  Batched filling of `sim::OpDetBacktrackerRecord` objects.
+ * @see    OpDetBacktrackerRecordBuilder.h
+ */
+
+#include "lardataobj/Simulation/OpDetBacktrackerRecordBuilder.h"
+#include "lardataobj/Utilities/ParallelChunks.h"
+
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <algorithm>     // std::stable_sort(), std::sort()
+#include <cmath>         // std::ceil(), std::round()
+#include <limits>        // std::numeric_limits
+#include <numeric>       // std::iota()
+#include <stdexcept>     // std::runtime_error
+#include <unordered_map>
+#include <utility>       // std::move(), std::pair
+
+namespace sim {
+
+  //-------------------------------------------------
+  OpDetBacktrackerRecordBuilder::OpDetBacktrackerRecordBuilder(int detNum) : fOpDetNum(detNum) {}
+
+  //-------------------------------------------------
+  void OpDetBacktrackerRecordBuilder::AddScintillationPhotons(TrackID_t trackID,
+                                                              timePDclock_t timePDclock,
+                                                              double numberPhotons,
+                                                              double const* xyz,
+                                                              double energy)
+  {
+    // same check as in OpDetBacktrackerRecord::AddScintillationPhotons()
+    if ((numberPhotons < std::numeric_limits<double>::epsilon()) ||
+        (energy <= std::numeric_limits<double>::epsilon())) {
+      MF_LOG_ERROR("OpDetBacktrackerRecord")
+        << "AddTrackPhotons() trying to add to iTimePDclock #" << timePDclock << " "
+        << numberPhotons << " photons with " << energy
+        << " MeV of energy from track ID=" << trackID;
+      return;
+    } // if no photons
+
+    fDeposits.push_back(
+      {timePDclock, trackID, numberPhotons, energy, xyz[0], xyz[1], xyz[2]});
+  } // OpDetBacktrackerRecordBuilder::AddScintillationPhotons()
+
+  //-------------------------------------------------
+  void OpDetBacktrackerRecordBuilder::Append(OpDetBacktrackerRecordBuilder const& other)
+  {
+    if (OpDetNum() != other.OpDetNum()) {
+      throw std::runtime_error(
+        "ERROR OpDetBacktrackerRecordBuilder Append: Trying to merge different channels!");
+    }
+    fDeposits.insert(fDeposits.end(), other.fDeposits.begin(), other.fDeposits.end());
+  } // OpDetBacktrackerRecordBuilder::Append()
+
+  //-------------------------------------------------
+  OpDetBacktrackerRecord OpDetBacktrackerRecordBuilder::Build(unsigned int nThreads /* = 1 */) const
+  {
+    using storedTimePDclock_t = OpDetBacktrackerRecord::storedTimePDclock_t;
+
+    constexpr std::size_t MinChunkSize = 64; // time entries
+
+    // assign each deposit to its time entry, in order of addition.
+    // All record times are rounded, and `AddScintillationPhotons()` adds to the
+    // first (oldest) entry at the closest time not earlier than the deposit
+    // time, when their distance truncated to an integer is not larger than
+    // 0.5 ns, i.e. when that entry is at the next whole nanosecond; otherwise
+    // it creates a new entry at the rounded deposit time, after any other
+    // entry at that time.
+    std::vector<storedTimePDclock_t> entryTimes;
+    std::vector<std::size_t> entries(fDeposits.size());
+    std::unordered_map<storedTimePDclock_t, std::size_t> firstEntries;
+    for (std::size_t iDeposit = 0; iDeposit < fDeposits.size(); ++iDeposit) {
+      timePDclock_t const time = fDeposits[iDeposit].time;
+      auto const itFirst = firstEntries.find(std::ceil(time));
+      if (itFirst != firstEntries.end()) {
+        entries[iDeposit] = itFirst->second;
+        continue;
+      }
+      storedTimePDclock_t const entryTime = std::round(time);
+      entries[iDeposit] = entryTimes.size();
+      firstEntries.try_emplace(entryTime, entryTimes.size());
+      entryTimes.push_back(entryTime);
+    } // for deposits
+
+    // position of each entry in the record: by time, then by creation
+    std::size_t const nEntries = entryTimes.size();
+    std::vector<std::size_t> entryOrder(nEntries);
+    std::iota(entryOrder.begin(), entryOrder.end(), 0);
+    std::stable_sort(entryOrder.begin(),
+                     entryOrder.end(),
+                     [&entryTimes](std::size_t a, std::size_t b) {
+                       return entryTimes[a] < entryTimes[b];
+                     });
+    std::vector<std::size_t> entryRanks(nEntries);
+    for (std::size_t rank = 0; rank < nEntries; ++rank)
+      entryRanks[entryOrder[rank]] = rank;
+
+    // group the deposits by entry with a counting sort, keeping their order
+    std::vector<std::size_t> entryStarts(nEntries + 1, 0);
+    for (std::size_t const entry : entries)
+      ++entryStarts[entryRanks[entry] + 1];
+    for (std::size_t rank = 0; rank < nEntries; ++rank)
+      entryStarts[rank + 1] += entryStarts[rank];
+    std::vector<std::size_t> order(fDeposits.size());
+    {
+      std::vector<std::size_t> nextPositions(entryStarts.begin(), entryStarts.end() - 1);
+      for (std::size_t iDeposit = 0; iDeposit < fDeposits.size(); ++iDeposit)
+        order[nextPositions[entryRanks[entries[iDeposit]]]++] = iDeposit;
+    }
+
+    // merge the deposits of each entry; if requested, contiguous chunks of
+    // entries are processed each by its own thread
+    OpDetBacktrackerRecord::timePDclockSDPs_t timeSDPs(nEntries);
+    util::ForEachChunk(
+      util::ChunkBoundaries(nEntries, nThreads, MinChunkSize),
+      [&](std::size_t, std::size_t begin, std::size_t end) {
+        // merged deposits of the current entry, with the index of their first deposit
+        std::vector<std::pair<std::size_t, sim::SDP>> entryDeposits;
+
+        for (std::size_t rank = begin; rank < end; ++rank) {
+          // deposits from the same track keep the order they were added with
+          auto const oBegin = order.begin() + entryStarts[rank];
+          auto const oEnd = order.begin() + entryStarts[rank + 1];
+          std::stable_sort(oBegin, oEnd, [this](std::size_t a, std::size_t b) {
+            return fDeposits[a].trackID < fDeposits[b].trackID;
+          });
+
+          entryDeposits.clear();
+          auto iOrder = oBegin;
+          while (iOrder != oEnd) {
+            Deposit_t const& first = fDeposits[*iOrder];
+            sim::SDP sdp(first.trackID, first.numPhotons, first.energy, first.x, first.y, first.z);
+            std::size_t const firstIndex = *iOrder;
+
+            // merge all the following deposits from the same track, with the same
+            // arithmetic as OpDetBacktrackerRecord::AddScintillationPhotons()
+            while ((++iOrder != oEnd) && (fDeposits[*iOrder].trackID == first.trackID)) {
+              Deposit_t const& deposit = fDeposits[*iOrder];
+              double weight = sdp.numPhotons + deposit.numPhotons;
+              sdp.x = (sdp.x * sdp.numPhotons + deposit.x * deposit.numPhotons) / weight;
+              sdp.y = (sdp.y * sdp.numPhotons + deposit.y * deposit.numPhotons) / weight;
+              sdp.z = (sdp.z * sdp.numPhotons + deposit.z * deposit.numPhotons) / weight;
+              sdp.numPhotons = weight;
+              sdp.energy = sdp.energy + deposit.energy;
+            } // while same track
+
+            entryDeposits.emplace_back(firstIndex, sdp);
+          } // while
+
+          // SDPs are in the order their track first appeared in the entry
+          std::sort(entryDeposits.begin(), entryDeposits.end(), [](auto const& a, auto const& b) {
+            return a.first < b.first;
+          });
+          auto& [time, sdps] = timeSDPs[rank];
+          time = entryTimes[entryOrder[rank]];
+          sdps.reserve(entryDeposits.size());
+          for (auto const& entryDeposit : entryDeposits)
+            sdps.push_back(entryDeposit.second);
+        } // for entries
+      });
+
+    return OpDetBacktrackerRecord{fOpDetNum, std::move(timeSDPs)};
+  } // OpDetBacktrackerRecordBuilder::Build()
+
+  //-------------------------------------------------
+
+} // namespace sim
@@ -0,0 +1,134 @@
+/**
+ * @file   lardataobj/Simulation/OpDetBacktrackerRecordBuilder.h
+ * @brief  Batched filling of `sim::OpDetBacktrackerRecord` objects.
+ * @see    OpDetBacktrackerRecordBuilder.cxx
+ */
+
+#ifndef LARDATAOBJ_SIMULATION_OPDETBACKTRACKERRECORDBUILDER_H
+#define LARDATAOBJ_SIMULATION_OPDETBACKTRACKERRECORDBUILDER_H
+
+// LArSoftObj libraries
+#include "lardataobj/Simulation/OpDetBacktrackerRecord.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace sim {
+
+  /**
+   * @brief Collects scintillation photons and creates a
+   *        `sim::OpDetBacktrackerRecord` at once.
+   *
+   * `sim::OpDetBacktrackerRecord::AddScintillationPhotons()` keeps the
+   * deposits sorted by time at every call, and looks for the track among the
+   * ones already at that time, which is expensive when an optical detector
+   * receives very many of them. This builder instead records each deposit in a
+   * flat list, and only when `Build()` is called it assigns them to their time
+   * entries, sorts them and merges them into the
+   * `sim::OpDetBacktrackerRecord` layout.
+   *
+   * The resulting record is the same as if all the deposits had been added,
+   * in the same order, with
+   * `sim::OpDetBacktrackerRecord::AddScintillationPhotons()` to an empty
+   * record: same time entries (including the rounding of the times and the
+   * matching of a time to an existing entry), same order of the `sim::SDP` in
+   * each entry, and the same values (the merge follows the same order and
+   * arithmetic).
+   *
+   * Builders filled separately (for example one per worker thread) can be
+   * combined with `Append()` before building the record; the result is as if
+   * the deposits of the appended builder had been added after the ones of this
+   * one.
+   *
+   * Example:
+   * @code
+   * sim::OpDetBacktrackerRecordBuilder builder{opDet};
+   * for (auto const& photons: detectedPhotons)
+   *   builder.AddScintillationPhotons(photons.trackID, photons.time, ...);
+   * sim::OpDetBacktrackerRecord const record = builder.Build();
+   * @endcode
+   */
+  class OpDetBacktrackerRecordBuilder {
+  public:
+    /// Type for time used in the interface.
+    using timePDclock_t = OpDetBacktrackerRecord::timePDclock_t;
+
+    /// Type of track ID (the value comes from Geant4).
+    using TrackID_t = OpDetBacktrackerRecord::TrackID_t;
+
+    /// Constructor: the deposits will be on the specified optical detector.
+    explicit OpDetBacktrackerRecordBuilder(int detNum);
+
+    /// Returns the number of the optical detector of the record being built.
+    int OpDetNum() const { return fOpDetNum; }
+
+    /// Prepares memory for `n` deposits.
+    void Reserve(std::size_t n) { fDeposits.reserve(n); }
+
+    /// Returns the number of deposits recorded so far.
+    std::size_t size() const { return fDeposits.size(); }
+
+    /// Returns whether no deposit was recorded.
+    bool empty() const { return fDeposits.empty(); }
+
+    /// Removes all recorded deposits (memory is kept for reuse).
+    void Clear() { fDeposits.clear(); }
+
+    /**
+     * @brief Records scintillation photons and energy for this optical detector
+     * @see `sim::OpDetBacktrackerRecord::AddScintillationPhotons()`
+     *
+     * The arguments have the same meaning as in
+     * `sim::OpDetBacktrackerRecord::AddScintillationPhotons()`, and invalid
+     * deposits (no photons or no energy) are also rejected in the same way.
+     */
+    void AddScintillationPhotons(TrackID_t trackID,
+                                 timePDclock_t timePDclock,
+                                 double numberPhotons,
+                                 double const* xyz,
+                                 double energy);
+
+    /**
+     * @brief Adds all the deposits recorded by another builder
+     * @param other the builder with the deposits to be added
+     * @throw std::runtime_error if the builders are for different detectors
+     *
+     * The deposits of `other` are added after the ones of this builder.
+     */
+    void Append(OpDetBacktrackerRecordBuilder const& other);
+
+    /**
+     * @brief Returns a `sim::OpDetBacktrackerRecord` with all the recorded deposits
+     * @param nThreads (default: `1`) number of threads for the merging
+     *
+     * The deposits are assigned to their time entries in order of addition,
+     * and grouped by entry with a counting sort. The deposits of each entry
+     * are then merged by track, all in the calling thread unless more
+     * threads are requested (see `util::ResolveThreads()`): then contiguous
+     * chunks of entries are merged each by its own thread (see
+     * `util::ForEachChunk()`), with a result which does not depend on the
+     * number of threads.
+     */
+    OpDetBacktrackerRecord Build(unsigned int nThreads = 1) const;
+
+  private:
+    /// A deposit as passed to `AddScintillationPhotons()`.
+    struct Deposit_t {
+      timePDclock_t time; ///< time of the deposit [ns]
+      TrackID_t trackID;  ///< Geant4 track ID
+      double numPhotons;  ///< number of photons
+      double energy;      ///< energy [MeV]
+      double x;           ///< x position of scintillation [cm]
+      double y;           ///< y position of scintillation [cm]
+      double z;           ///< z position of scintillation [cm]
+    };
+
+    int fOpDetNum;                    ///< optical detector of the deposits
+    std::vector<Deposit_t> fDeposits; ///< deposits, in order of addition
+
+  }; // class OpDetBacktrackerRecordBuilder
+
+} // namespace sim
+
+#endif // LARDATAOBJ_SIMULATION_OPDETBACKTRACKERRECORDBUILDER_H
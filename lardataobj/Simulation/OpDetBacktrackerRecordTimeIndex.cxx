@@ -0,0 +1,228 @@
+/**
+ * @file   lardataobj/Simulation/OpDetBacktrackerRecordTimeIndex.cxx
+ * @brief  Index of the times of a `sim::OpDetBacktrackerRecord` in fixed bins.
+ * @see    OpDetBacktrackerRecordTimeIndex.h
+ */
+
+#include "lardataobj/Simulation/OpDetBacktrackerRecordTimeIndex.h"
+
+// Framework libraries
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::lower_bound(), std::upper_bound()
+#include <cmath>     // std::floor(), std::isnan()
+#include <stdexcept> // std::invalid_argument
+
+namespace sim {
+
+  //-------------------------------------------------
+  OpDetBacktrackerRecordTimeIndex::OpDetBacktrackerRecordTimeIndex(
+    OpDetBacktrackerRecord const& record,
+    double binWidth)
+    : fRecord(&record), fBinWidth(binWidth)
+  {
+    if (!(binWidth > 0.0)) {
+      throw std::invalid_argument(
+        "sim::OpDetBacktrackerRecordTimeIndex: bin width must be positive");
+    }
+
+    auto const& timeSDPs = record.timePDclockSDPsMap();
+
+    fPhotonSums.reserve(timeSDPs.size() + 1);
+    fEnergySums.reserve(timeSDPs.size() + 1);
+    fPhotonSums.push_back(0.0);
+    fEnergySums.push_back(0.0);
+    for (auto const& [time, sdps] : timeSDPs) {
+      double photons = 0.0, energy = 0.0;
+      for (auto const& sdp : sdps) {
+        photons += sdp.numPhotons;
+        energy += sdp.energy;
+      }
+      fPhotonSums.push_back(fPhotonSums.back() + photons);
+      fEnergySums.push_back(fEnergySums.back() + energy);
+    } // for
+
+    if (timeSDPs.empty()) return;
+
+    // the bin of each entry is computed with the same expression as in
+    // `binOf()`, which is not decreasing with time; entries are sorted by time,
+    // so each bin holds a contiguous range of them
+    // the number of bins is capped, widening the bins when needed
+    fStartTime = timeSDPs.front().first;
+    double const timeSpan = timeSDPs.back().first - fStartTime;
+    double const maxBins = static_cast<double>(MaxBinsPerEntry * timeSDPs.size());
+    if (!(timeSpan / fBinWidth < maxBins - 1.0)) fBinWidth = timeSpan / (maxBins - 1.0);
+    double const span = std::floor(timeSpan / fBinWidth);
+    if (!(span < maxBins)) { // only non-finite times get here
+      throw std::invalid_argument(
+        "sim::OpDetBacktrackerRecordTimeIndex: time span of the record is not finite");
+    }
+    std::size_t const nBins = static_cast<std::size_t>(span) + 1;
+
+    fBinFirst.reserve(nBins + 1);
+    std::size_t iEntry = 0;
+    for (std::size_t iBin = 0; iBin < nBins; ++iBin) {
+      fBinFirst.push_back(iEntry);
+      while ((iEntry < timeSDPs.size()) &&
+             (std::floor((timeSDPs[iEntry].first - fStartTime) / fBinWidth) <= iBin))
+        ++iEntry;
+    } // for bins
+    fBinFirst.push_back(timeSDPs.size());
+
+  } // OpDetBacktrackerRecordTimeIndex::OpDetBacktrackerRecordTimeIndex()
+
+  //-------------------------------------------------
+  std::size_t OpDetBacktrackerRecordTimeIndex::FirstEntryNotBefore(timePDclock_t time) const
+  {
+    return findEntry(time, false);
+  }
+
+  //-------------------------------------------------
+  std::size_t OpDetBacktrackerRecordTimeIndex::FirstEntryAfter(timePDclock_t time) const
+  {
+    return findEntry(time, true);
+  }
+
+  //-------------------------------------------------
+  double OpDetBacktrackerRecordTimeIndex::Photons(timePDclock_t time) const
+  {
+    auto const& timeSDPs = fRecord->timePDclockSDPsMap();
+    std::size_t const iEntry = FirstEntryNotBefore(time);
+    if ((iEntry == timeSDPs.size()) || (timeSDPs[iEntry].first != time)) return 0.0;
+
+    double numPhotons = 0.;
+    for (auto const& sdp : timeSDPs[iEntry].second)
+      numPhotons += sdp.numPhotons;
+    return numPhotons;
+  } // OpDetBacktrackerRecordTimeIndex::Photons()
+
+  //-------------------------------------------------
+  double OpDetBacktrackerRecordTimeIndex::Energy(timePDclock_t time) const
+  {
+    auto const& timeSDPs = fRecord->timePDclockSDPsMap();
+    std::size_t const iEntry = FirstEntryNotBefore(time);
+    if ((iEntry == timeSDPs.size()) || (timeSDPs[iEntry].first != time)) return 0.0;
+
+    double energy = 0.;
+    for (auto const& sdp : timeSDPs[iEntry].second)
+      energy += sdp.energy;
+    return energy;
+  } // OpDetBacktrackerRecordTimeIndex::Energy()
+
+  //-------------------------------------------------
+  double OpDetBacktrackerRecordTimeIndex::PhotonsInRange(timePDclock_t startTime,
+                                                         timePDclock_t endTime) const
+  {
+    if (!(startTime <= endTime)) return 0.0;
+    return fPhotonSums[FirstEntryAfter(endTime)] - fPhotonSums[FirstEntryNotBefore(startTime)];
+  }
+
+  //-------------------------------------------------
+  double OpDetBacktrackerRecordTimeIndex::EnergyInRange(timePDclock_t startTime,
+                                                        timePDclock_t endTime) const
+  {
+    if (!(startTime <= endTime)) return 0.0;
+    return fEnergySums[FirstEntryAfter(endTime)] - fEnergySums[FirstEntryNotBefore(startTime)];
+  }
+
+  //-------------------------------------------------
+  std::vector<sim::SDP> OpDetBacktrackerRecordTimeIndex::TrackIDsAndEnergies(
+    timePDclock_t startTime,
+    timePDclock_t endTime) const
+  {
+    std::vector<sim::SDP> sdps;
+    TrackIDsAndEnergies(startTime, endTime, sdps);
+    return sdps;
+  }
+
+  //-------------------------------------------------
+  void OpDetBacktrackerRecordTimeIndex::TrackIDsAndEnergies(timePDclock_t startTime,
+                                                            timePDclock_t endTime,
+                                                            std::vector<sim::SDP>& sdps) const
+  {
+    sdps.clear();
+
+    if (!(startTime <= endTime)) {
+      mf::LogWarning("OpDetBacktrackerRecordTimeIndex")
+        << "requested TimePDclock range is bogus: " << startTime << " " << endTime
+        << " return empty vector";
+      return;
+    }
+
+    auto const& timeSDPs = fRecord->timePDclockSDPsMap();
+    std::size_t const iEnd = FirstEntryAfter(endTime);
+    for (std::size_t iEntry = FirstEntryNotBefore(startTime); iEntry < iEnd; ++iEntry) {
+      for (auto const& sdp : timeSDPs[iEntry].second)
+        details::AddToTrackSDPs(sdps, sdp);
+    }
+  } // OpDetBacktrackerRecordTimeIndex::TrackIDsAndEnergies()
+
+  //-------------------------------------------------
+  std::vector<sim::TrackSDP> OpDetBacktrackerRecordTimeIndex::TrackSDPs(
+    timePDclock_t startTime,
+    timePDclock_t endTime) const
+  {
+    std::vector<sim::TrackSDP> trackSDPs;
+    std::vector<sim::SDP> sdps;
+    TrackSDPs(startTime, endTime, trackSDPs, sdps);
+    return trackSDPs;
+  }
+
+  //-------------------------------------------------
+  void OpDetBacktrackerRecordTimeIndex::TrackSDPs(timePDclock_t startTime,
+                                                  timePDclock_t endTime,
+                                                  std::vector<sim::TrackSDP>& trackSDPs,
+                                                  std::vector<sim::SDP>& sdps) const
+  {
+    trackSDPs.clear();
+    sdps.clear();
+
+    if (!(startTime <= endTime)) {
+      mf::LogWarning("OpDetBacktrackerRecordTimeIndex::TrackSDPs")
+        << "requested iTimePDclock range is bogus: " << startTime << " " << endTime
+        << " return empty vector";
+      return;
+    }
+
+    TrackIDsAndEnergies(startTime, endTime, sdps);
+    details::FillTrackSDPs(sdps, trackSDPs);
+  } // OpDetBacktrackerRecordTimeIndex::TrackSDPs()
+
+  //-------------------------------------------------
+  long long OpDetBacktrackerRecordTimeIndex::binOf(timePDclock_t time) const
+  {
+    double const bin = std::floor((time - fStartTime) / fBinWidth);
+    if (bin < 0.0) return -1;
+    if (bin >= static_cast<double>(NBins())) return static_cast<long long>(NBins());
+    return static_cast<long long>(bin);
+  } // OpDetBacktrackerRecordTimeIndex::binOf()
+
+  //-------------------------------------------------
+  std::size_t OpDetBacktrackerRecordTimeIndex::findEntry(timePDclock_t time, bool after) const
+  {
+    auto const& timeSDPs = fRecord->timePDclockSDPsMap();
+
+    // no entry is before, at or after an undefined time
+    if (std::isnan(time)) return timeSDPs.size();
+
+    // all entries of earlier bins are earlier than `time`,
+    // all entries of later bins are later than `time`
+    long long const bin = binOf(time);
+    if (bin < 0) return 0;
+    if (bin >= static_cast<long long>(NBins())) return timeSDPs.size();
+
+    auto const begin = timeSDPs.begin() + fBinFirst[bin];
+    auto const end = timeSDPs.begin() + fBinFirst[bin + 1];
+    auto const itEntry =
+      after ?
+        std::upper_bound(
+          begin, end, time, [](double t, auto const& entry) { return t < entry.first; }) :
+        std::lower_bound(
+          begin, end, time, [](auto const& entry, double t) { return entry.first < t; });
+    return itEntry - timeSDPs.begin();
+  } // OpDetBacktrackerRecordTimeIndex::findEntry()
+
+  //-------------------------------------------------
+
+} // namespace sim
@@ -0,0 +1,142 @@
+/**
+ * @file   lardataobj/Simulation/OpDetBacktrackerRecordTimeIndex.h
+ * @brief  Index of the times of a `sim::OpDetBacktrackerRecord` in fixed bins.
+ * @see    OpDetBacktrackerRecordTimeIndex.cxx
+ */
+
+#ifndef LARDATAOBJ_SIMULATION_OPDETBACKTRACKERRECORDTIMEINDEX_H
+#define LARDATAOBJ_SIMULATION_OPDETBACKTRACKERRECORDTIMEINDEX_H
+
+// LArSoftObj libraries
+#include "lardataobj/Simulation/OpDetBacktrackerRecord.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace sim {
+
+  /**
+   * @brief Index of the time entries of a `sim::OpDetBacktrackerRecord`.
+   *
+   * The time entries of a `sim::OpDetBacktrackerRecord` are looked up with a
+   * binary search on their time.
+   * This object divides the time span of the record into bins of fixed width,
+   * and remembers the first entry of each bin: the entries around a given time
+   * are then found directly in the bin that time falls into, and only the
+   * entries of that bin are searched.
+   * The index also keeps the cumulative number of photons and energy of the
+   * entries, so that the totals in a time interval are obtained without
+   * visiting the entries.
+   *
+   * The queries mirror the ones of `sim::OpDetBacktrackerRecord` and give the
+   * same results (except for the rounding of `PhotonsInRange()` and
+   * `EnergyInRange()`, which are differences of cumulative sums).
+   *
+   * The memory used by the index is proportional to the time span of the
+   * record divided by the bin width; a bin width similar to the typical
+   * time window of the queries (e.g. the width of an optical hit) is usually
+   * a good choice.
+   * The number of bins is capped to `MaxBinsPerEntry` times the number of time
+   * entries: when the requested width would exceed it (e.g. when a few
+   * entries are very far from the others), the bins are widened, and
+   * `BinWidth()` is larger than requested.
+   * The index refers to the record it was built from, which must outlive it
+   * and must not be modified.
+   */
+  class OpDetBacktrackerRecordTimeIndex {
+  public:
+    /// Type for time used in the interface.
+    using timePDclock_t = OpDetBacktrackerRecord::timePDclock_t;
+
+    /// Maximum number of bins for each time entry of the record.
+    static constexpr std::size_t MaxBinsPerEntry = 4;
+
+    /**
+     * @brief Constructor: indexes the specified record
+     * @param record the record to be indexed
+     * @param binWidth the requested width of the time bins [ns]
+     * @throw std::invalid_argument if the bin width is not positive, or the
+     *        times of the record are not finite
+     */
+    OpDetBacktrackerRecordTimeIndex(OpDetBacktrackerRecord const& record, double binWidth);
+
+    /// Returns the indexed record.
+    OpDetBacktrackerRecord const& Record() const { return *fRecord; }
+
+    /// Returns the width of the time bins [ns], at least the requested one.
+    double BinWidth() const { return fBinWidth; }
+
+    /// Returns the number of time bins.
+    std::size_t NBins() const { return fBinFirst.empty() ? 0 : fBinFirst.size() - 1; }
+
+    /// Returns the index of the first time entry not earlier than `time`
+    /// (the number of entries if none, or if `time` is NaN).
+    std::size_t FirstEntryNotBefore(timePDclock_t time) const;
+
+    /// Returns the index of the first time entry later than `time`
+    /// (the number of entries if none, or if `time` is NaN).
+    std::size_t FirstEntryAfter(timePDclock_t time) const;
+
+    /// Returns the total number of photons at the specified time.
+    /// @see `sim::OpDetBacktrackerRecord::Photons()`
+    double Photons(timePDclock_t time) const;
+
+    /// Returns the total energy at the specified time [MeV].
+    /// @see `sim::OpDetBacktrackerRecord::Energy()`
+    double Energy(timePDclock_t time) const;
+
+    /// Returns the total number of photons in a time interval (both included).
+    double PhotonsInRange(timePDclock_t startTime, timePDclock_t endTime) const;
+
+    /// Returns the total energy in a time interval (both included) [MeV].
+    double EnergyInRange(timePDclock_t startTime, timePDclock_t endTime) const;
+
+    /// Returns the deposits of each track in a time interval (both included).
+    /// @see `sim::OpDetBacktrackerRecord::TrackIDsAndEnergies()`
+    std::vector<sim::SDP> TrackIDsAndEnergies(timePDclock_t startTime,
+                                              timePDclock_t endTime) const;
+
+    /// Fills the deposits of each track in a time interval (both included).
+    /// @see `sim::OpDetBacktrackerRecord::TrackIDsAndEnergies()`
+    void TrackIDsAndEnergies(timePDclock_t startTime,
+                             timePDclock_t endTime,
+                             std::vector<sim::SDP>& sdps) const;
+
+    /// Returns the photons of each track in a time interval (both included).
+    /// @see `sim::OpDetBacktrackerRecord::TrackSDPs()`
+    std::vector<sim::TrackSDP> TrackSDPs(timePDclock_t startTime, timePDclock_t endTime) const;
+
+    /// Fills the photons of each track in a time interval (both included).
+    /// @see `sim::OpDetBacktrackerRecord::TrackSDPs()`
+    void TrackSDPs(timePDclock_t startTime,
+                   timePDclock_t endTime,
+                   std::vector<sim::TrackSDP>& trackSDPs,
+                   std::vector<sim::SDP>& sdps) const;
+
+  private:
+    OpDetBacktrackerRecord const* fRecord; ///< the indexed record
+    double fBinWidth;                      ///< width of the time bins [ns]
+    double fStartTime = 0.0;               ///< start time of the first bin [ns]
+
+    /// Index of the first entry of each bin; one extra entry.
+    std::vector<std::size_t> fBinFirst;
+
+    /// Photons in all the entries before each one; one extra entry.
+    std::vector<double> fPhotonSums;
+
+    /// Energy in all the entries before each one; one extra entry [MeV].
+    std::vector<double> fEnergySums;
+
+    /// Returns the bin of `time`, clamped between `-1` and `NBins()`.
+    long long binOf(timePDclock_t time) const;
+
+    /// Returns the index of the first entry not earlier than `time` (`after`
+    /// `false`) or later than `time` (`after` `true`).
+    std::size_t findEntry(timePDclock_t time, bool after) const;
+
+  }; // class OpDetBacktrackerRecordTimeIndex
+
+} // namespace sim
+
+#endif // LARDATAOBJ_SIMULATION_OPDETBACKTRACKERRECORDTIMEINDEX_H
@@ -6,9 +6,12 @@
 ///
 ////////////////////////////////////////////////////////////////////////
 
-#include <algorithm> // std::lower_bound(), std::max()
-#include <limits>    // std::numeric_limits
-#include <map>
+#include <algorithm>  // std::lower_bound(), std::max(), std::stable_sort()
+#include <cstdlib>    // std::abs()
+#include <functional> // std::greater<>
+#include <limits>     // std::numeric_limits
+#include <numeric>    // std::iota()
+#include <queue>
 #include <stdexcept>
 #include <utility>
 
@@ -45,6 +48,11 @@ namespace sim {
   //-------------------------------------------------
   SimChannel::SimChannel(raw::ChannelID_t channel) : fChannel(channel) {}
 
+  //-------------------------------------------------
+  SimChannel::SimChannel(raw::ChannelID_t channel, TDCIDEs_t&& tdcIDEs)
+    : fChannel(channel), fTDCIDEs(std::move(tdcIDEs))
+  {}
+
   //-------------------------------------------------
   void SimChannel::AddIonizationElectrons(TrackID_t trackID,
                                           TDC_t tdc,
@@ -118,7 +126,7 @@ namespace sim {
 
       // loop over the list for this tdc value and add up
       // the total number of electrons
-      for (auto ide : itr->second) {
+      for (auto const& ide : itr->second) {
         charge += ide.numElectrons;
       } // end loop over sim::IDE for this tdc
 
@@ -139,7 +147,7 @@ namespace sim {
 
       // loop over the list for this tdc value and add up
       // the total number of electrons
-      for (auto ide : itr->second) {
+      for (auto const& ide : itr->second) {
         energy += ide.energy;
       } // end loop over sim::IDE for this tdc
 
@@ -152,16 +160,25 @@ namespace sim {
   // the start and end tdc values are assumed to be inclusive
   std::vector<sim::IDE> SimChannel::TrackIDsAndEnergies(TDC_t startTDC, TDC_t endTDC) const
   {
-    // make a map of track ID values to sim::IDE objects
+    std::vector<sim::IDE> ides;
+    TrackIDsAndEnergies(startTDC, endTDC, ides);
+    return ides;
+  }
+
+  //-----------------------------------------------------------------------
+  // the start and end tdc values are assumed to be inclusive
+  void SimChannel::TrackIDsAndEnergies(TDC_t startTDC,
+                                       TDC_t endTDC,
+                                       std::vector<sim::IDE>& ides) const
+  {
+    ides.clear();
 
     if (startTDC > endTDC) {
       mf::LogWarning("SimChannel")
         << "requested tdc range is bogus: " << startTDC << " " << endTDC << " return empty vector";
-      return {}; // returns an empty vector
+      return;
     }
 
-    std::map<TrackID_t, sim::IDE> idToIDE;
-
     //find the lower bound for this tdc and then iterate from there
     auto itr = findClosestTDCIDE(startTDC);
 
@@ -171,76 +188,83 @@ namespace sim {
       // are outside the range
       if (itr->first > endTDC) break;
 
-      // grab the vector of IDEs for this tdc
-      auto const& idelist = itr->second;
-      // now loop over them and add their content to the map
-      for (auto const& ide : idelist) {
-        auto itTrkIDE = idToIDE.find(ide.trackID);
-        if (itTrkIDE != idToIDE.end()) {
-          // the IDE we are going to update:
-          sim::IDE& trackIDE = itTrkIDE->second;
-
-          double const nel1 = trackIDE.numElectrons;
-          double const nel2 = ide.numElectrons;
-          double const en1 = trackIDE.energy;
-          double const en2 = ide.energy;
-          double const energy = en1 + en2;
-          double const weight = nel1 + nel2;
-
-          // make a weighted average for the location information
-          trackIDE.x = (ide.x * nel2 + trackIDE.x * nel1) / weight;
-          trackIDE.y = (ide.y * nel2 + trackIDE.y * nel1) / weight;
-          trackIDE.z = (ide.z * nel2 + trackIDE.z * nel1) / weight;
-          trackIDE.numElectrons = weight;
-          trackIDE.energy = energy;
-        } // end if the track id for this one is found
-        else {
-          idToIDE[ide.trackID] = sim::IDE(ide);
-        }
-      } // end loop over vector
+      // add all the IDEs for this tdc to the list, sorted by track ID
+      for (auto const& ide : itr->second)
+        details::AddToTrackIDEs(ides, ide);
 
       ++itr;
     } // end loop over tdc values
-
-    // now fill the vector with the ides from the map
-    std::vector<sim::IDE> ides;
-    ides.reserve(idToIDE.size());
-    for (auto const& itr : idToIDE) {
-      ides.push_back(itr.second);
-    }
-
-    return ides;
   }
 
   //-----------------------------------------------------------------------
   // the start and end tdc values are assumed to be inclusive
   std::vector<sim::TrackIDE> SimChannel::TrackIDEs(TDC_t startTDC, TDC_t endTDC) const
   {
-
     std::vector<sim::TrackIDE> trackIDEs;
+    std::vector<sim::IDE> ides;
+    TrackIDEs(startTDC, endTDC, trackIDEs, ides);
+    return trackIDEs;
+  }
+
+  //-----------------------------------------------------------------------
+  void SimChannel::TrackIDEs(TDC_t startTDC,
+                             TDC_t endTDC,
+                             std::vector<sim::TrackIDE>& trackIDEs,
+                             std::vector<sim::IDE>& ides) const
+  {
+    trackIDEs.clear();
+    ides.clear();
 
     if (startTDC > endTDC) {
       mf::LogWarning("SimChannel::TrackIDEs")
         << "requested tdc range is bogus: " << startTDC << " " << endTDC << " return empty vector";
-      return trackIDEs;
+      return;
     }
 
-    double totalE = 0.;
-    std::vector<sim::IDE> const ides = TrackIDsAndEnergies(startTDC, endTDC);
-    for (auto const& ide : ides)
-      totalE += ide.energy;
+    TrackIDsAndEnergies(startTDC, endTDC, ides);
+    details::FillTrackIDEs(ides, trackIDEs);
+  }
 
-    // protect against a divide by zero below
-    if (totalE < 1.e-5) totalE = 1.;
+  //-----------------------------------------------------------------------
+  void SimChannel::TrackIDEsBatch(std::span<TDCWindow_t const> windows,
+                                  std::vector<std::vector<sim::TrackIDE>>& trackIDEs) const
+  {
+    trackIDEs.resize(windows.size());
+
+    // process the windows in order of start TDC
+    std::vector<std::size_t> order(windows.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [windows](std::size_t a, std::size_t b) {
+      return windows[a].startTDC < windows[b].startTDC;
+    });
+
+    std::vector<sim::IDE> ides; // reused for all the windows
+    auto itr = fTDCIDEs.begin();
+    for (std::size_t const iWindow : order) {
+      TDCWindow_t const& window = windows[iWindow];
+      std::vector<sim::TrackIDE>& windowIDEs = trackIDEs[iWindow];
+      windowIDEs.clear();
+
+      if (window.startTDC > window.endTDC) {
+        mf::LogWarning("SimChannel::TrackIDEsBatch")
+          << "requested tdc range is bogus: " << window.startTDC << " " << window.endTDC
+          << " return empty vector";
+        continue;
+      }
 
-    // loop over the entries in the map and fill the input vectors
-    for (auto const& ide : ides) {
-      if (ide.trackID == sim::NoParticleId) continue;
-      trackIDEs.emplace_back(
-        ide.trackID, ide.energy / totalE, ide.energy, ide.numElectrons, ide.origTrackID);
-    }
+      // the start of the windows never moves back
+      while ((itr != fTDCIDEs.end()) && (itr->first < window.startTDC))
+        ++itr;
 
-    return trackIDEs;
+      ides.clear();
+      for (auto itTDC = itr; (itTDC != fTDCIDEs.end()) && (itTDC->first <= window.endTDC);
+           ++itTDC) {
+        for (auto const& ide : itTDC->second)
+          details::AddToTrackIDEs(ides, ide);
+      }
+
+      details::FillTrackIDEs(ides, windowIDEs);
+    } // for windows
   }
 
   //-----------------------------------------------------------------------
@@ -250,39 +274,84 @@ namespace sim {
     SimChannel const& channel,
     int offset)
   {
-    if (this->Channel() != channel.Channel())
-      throw std::runtime_error("ERROR SimChannel Merge: Trying to merge different channels!");
-
-    std::pair<TrackID_t, TrackID_t> range_trackID(std::numeric_limits<int>::max(),
-                                                  std::numeric_limits<int>::min());
-
-    for (auto const& itr : channel.TDCIDEMap()) {
+    SimChannel const* const channels[] = {&channel};
+    int const offsets[] = {offset};
+    return MergeSimChannels(channels, offsets).front();
+  }
 
-      auto tdc = itr.first;
-      auto const& ides = itr.second;
+  //-----------------------------------------------------------------------
+  std::vector<std::pair<SimChannel::TrackID_t, SimChannel::TrackID_t>> SimChannel::MergeSimChannels(
+    std::span<SimChannel const* const> channels,
+    std::span<int const> offsets)
+  {
+    if (channels.size() != offsets.size()) {
+      throw std::runtime_error(
+        "ERROR SimChannel Merge: the number of offsets does not match the number of channels!");
+    }
+    for (SimChannel const* channel : channels) {
+      if (this->Channel() != channel->Channel())
+        throw std::runtime_error("ERROR SimChannel Merge: Trying to merge different channels!");
+    }
 
-      // find the entry from this SimChannel corresponding to the tdc from the other
-      auto itrthis = findClosestTDCIDE(tdc);
+    std::vector<std::pair<TrackID_t, TrackID_t>> ranges_trackID(
+      channels.size(), {std::numeric_limits<int>::max(), std::numeric_limits<int>::min()});
+
+    // source #0 is this channel, source #i is channels[i - 1]
+    auto const sourceTDCs = [this, channels](std::size_t source) -> TDCIDEs_t const& {
+      return (source == 0) ? fTDCIDEs : channels[source - 1]->fTDCIDEs;
+    };
+    std::size_t const nSources = channels.size() + 1;
+
+    // next TDC from each source; the smallest TDC comes first, and with the
+    // same TDC the sources come in order (this channel first)
+    using Cursor_t = std::pair<StoredTDC_t, std::size_t>;
+    std::priority_queue<Cursor_t, std::vector<Cursor_t>, std::greater<Cursor_t>> nextTDCs;
+    std::vector<std::size_t> positions(nSources, 0);
+    std::size_t nTDCs = 0;
+    for (std::size_t source = 0; source < nSources; ++source) {
+      TDCIDEs_t const& tdcIDEs = sourceTDCs(source);
+      nTDCs += tdcIDEs.size();
+      if (!tdcIDEs.empty()) nextTDCs.emplace(tdcIDEs.front().first, source);
+    }
 
-      // pick which IDE list we have to fill: new one or existing one
-      std::vector<sim::IDE>* curIDEVec;
-      if (itrthis == fTDCIDEs.end() || itrthis->first != tdc) {
-        fTDCIDEs.emplace_back(tdc, std::vector<sim::IDE>());
-        curIDEVec = &(fTDCIDEs.back().second);
+    TDCIDEs_t merged;
+    merged.reserve(nTDCs);
+    while (!nextTDCs.empty()) {
+      auto const [tdc, source] = nextTDCs.top();
+      nextTDCs.pop();
+
+      std::size_t const pos = positions[source]++;
+      if (merged.empty() || merged.back().first != tdc)
+        merged.emplace_back(tdc, std::vector<sim::IDE>());
+      std::vector<sim::IDE>& curIDEVec = merged.back().second;
+
+      if (source == 0) { // this channel comes first: take its list
+        if (curIDEVec.empty())
+          curIDEVec = std::move(fTDCIDEs[pos].second);
+        else // repeated TDC in this channel
+          curIDEVec.insert(
+            curIDEVec.end(), fTDCIDEs[pos].second.begin(), fTDCIDEs[pos].second.end());
+      }
+      else {
+        int const offset = offsets[source - 1];
+        auto& range_trackID = ranges_trackID[source - 1];
+        auto const& ides = channels[source - 1]->fTDCIDEs[pos].second;
+        curIDEVec.reserve(curIDEVec.size() + ides.size());
+        for (auto const& ide : ides) {
+          curIDEVec.emplace_back(ide, offset);
+          auto tid = std::abs(ide.trackID) + offset;
+          if (tid < range_trackID.first) range_trackID.first = tid;
+          if (tid > range_trackID.second) range_trackID.second = tid;
+        } //end loop over IDEs
       }
-      else
-        curIDEVec = &(itrthis->second);
 
-      for (auto const& ide : ides) {
-        curIDEVec->emplace_back(ide, offset);
-        auto tid = std::abs(ide.trackID) + offset;
-        if (tid < range_trackID.first) range_trackID.first = tid;
-        if (tid > range_trackID.second) range_trackID.second = tid;
-      } //end loop over IDEs
+      TDCIDEs_t const& tdcIDEs = sourceTDCs(source);
+      if (pos + 1 < tdcIDEs.size()) nextTDCs.emplace(tdcIDEs[pos + 1].first, source);
+    } // while
 
-    } //end loop over TDCIDEMap
+    fTDCIDEs = std::move(merged);
 
-    return range_trackID;
+    return ranges_trackID;
   }
 
   //-------------------------------------------------
@@ -307,5 +376,57 @@ namespace sim {
   }
 
   //-------------------------------------------------
+  void details::AddToTrackIDEs(std::vector<sim::IDE>& trackIDEs, sim::IDE const& ide)
+  {
+    // a sorted flat list: there are usually only a few tracks
+    auto itTrkIDE = std::lower_bound(
+      trackIDEs.begin(), trackIDEs.end(), ide.trackID, [](sim::IDE const& a, IDE::TrackID_t id) {
+        return a.trackID < id;
+      });
+    if (itTrkIDE == trackIDEs.end() || itTrkIDE->trackID != ide.trackID) {
+      trackIDEs.insert(itTrkIDE, ide);
+      return;
+    }
+
+    // the IDE we are going to update:
+    sim::IDE& trackIDE = *itTrkIDE;
+
+    double const nel1 = trackIDE.numElectrons;
+    double const nel2 = ide.numElectrons;
+    double const en1 = trackIDE.energy;
+    double const en2 = ide.energy;
+    double const energy = en1 + en2;
+    double const weight = nel1 + nel2;
+
+    // make a weighted average for the location information
+    trackIDE.x = (ide.x * nel2 + trackIDE.x * nel1) / weight;
+    trackIDE.y = (ide.y * nel2 + trackIDE.y * nel1) / weight;
+    trackIDE.z = (ide.z * nel2 + trackIDE.z * nel1) / weight;
+    trackIDE.numElectrons = weight;
+    trackIDE.energy = energy;
+  } // details::AddToTrackIDEs()
+
+  //-------------------------------------------------
+  void details::FillTrackIDEs(std::vector<sim::IDE> const& ides,
+                              std::vector<sim::TrackIDE>& trackIDEs)
+  {
+    trackIDEs.clear();
+
+    double totalE = 0.;
+    for (auto const& ide : ides)
+      totalE += ide.energy;
+
+    // protect against a divide by zero below
+    if (totalE < 1.e-5) totalE = 1.;
+
+    // loop over the entries in the map and fill the input vectors
+    for (auto const& ide : ides) {
+      if (ide.trackID == sim::NoParticleId) continue;
+      trackIDEs.emplace_back(
+        ide.trackID, ide.energy / totalE, ide.energy, ide.numElectrons, ide.origTrackID);
+    }
+  } // details::FillTrackIDEs()
+
+  //-------------------------------------------------
 
 }
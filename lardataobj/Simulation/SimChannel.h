@@ -16,6 +16,7 @@
 #include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"          // raw::ChannelID_t
 
 // C/C++ standard libraries
+#include <span>
 #include <string>
 #include <utility> // std::pair
 #include <vector>
@@ -160,6 +161,16 @@ namespace sim {
     /// Constructor: immediately sets the channel number
     explicit SimChannel(raw::ChannelID_t channel);
 
+    /**
+     * @brief Constructor: sets the channel number and all the deposits
+     * @param channel the readout channel
+     * @param tdcIDEs the deposits for each TDC, sorted by increasing TDC
+     *
+     * The TDC ticks in `tdcIDEs` are expected to be all different and sorted;
+     * this is not checked.
+     */
+    SimChannel(raw::ChannelID_t channel, TDCIDEs_t&& tdcIDEs);
+
     /**
      * @brief Add ionization electrons and energy to this channel
      * @param trackID ID of simulated track depositing this energy (from Geant4)
@@ -200,6 +211,19 @@ namespace sim {
      */
     std::vector<sim::IDE> TrackIDsAndEnergies(TDC_t startTDC, TDC_t endTDC) const;
 
+    /**
+     * @brief Fills the recorded energy deposition within a time interval
+     * @param startTDC TDC tick opening the time window
+     * @param endTDC TDC tick closing the time window (included in the interval)
+     * @param ides the collection to be filled (previous content is removed)
+     * @see TrackIDsAndEnergies(TDC_t, TDC_t) const
+     *
+     * This is the same as `TrackIDsAndEnergies(TDC_t, TDC_t) const`, but the
+     * result is written into `ides`. When the same `ides` is reused for many
+     * calls (e.g. one per hit), its memory is reused as well.
+     */
+    void TrackIDsAndEnergies(TDC_t startTDC, TDC_t endTDC, std::vector<sim::IDE>& ides) const;
+
     /**
      * @brief Returns all the deposited energy information as stored
      * @return all the deposited energy information as stored in the object
@@ -244,6 +268,50 @@ namespace sim {
      */
     std::vector<sim::TrackIDE> TrackIDEs(TDC_t startTDC, TDC_t endTDC) const;
 
+    /**
+     * @brief Fills energies collected for each track within a time interval
+     * @param startTDC TDC tick opening the time window
+     * @param endTDC TDC tick closing the time window (included in the interval)
+     * @param trackIDEs the collection to be filled (previous content is removed)
+     * @param ides buffer for the deposits of each track (previous content is removed)
+     * @see TrackIDEs(TDC_t, TDC_t) const
+     *
+     * This is the same as `TrackIDEs(TDC_t, TDC_t) const`, but the result is
+     * written into `trackIDEs`. The deposits of each track are collected in
+     * `ides`, which on return holds the same as
+     * `TrackIDsAndEnergies(startTDC, endTDC)`.
+     * When the same `trackIDEs` and `ides` are reused for many calls (e.g. one
+     * per hit), their memory is reused as well.
+     */
+    void TrackIDEs(TDC_t startTDC,
+                   TDC_t endTDC,
+                   std::vector<sim::TrackIDE>& trackIDEs,
+                   std::vector<sim::IDE>& ides) const;
+
+    /// A time interval, between two TDC ticks (both included).
+    struct TDCWindow_t {
+      TDC_t startTDC; ///< TDC tick opening the time window
+      TDC_t endTDC;   ///< TDC tick closing the time window (included)
+    };
+
+    /**
+     * @brief Returns energies collected for each track in many time intervals
+     * @param windows the time intervals
+     * @param trackIDEs the collection to be filled, one entry per window
+     * @see TrackIDEs()
+     *
+     * This method fills `trackIDEs[i]` with the same result as
+     * `TrackIDEs(windows[i].startTDC, windows[i].endTDC)`.
+     * The windows are processed in order of start TDC, sweeping the list of
+     * TDC ticks only once, instead of searching it for each window. This is
+     * convenient when querying all the hits on a channel at once.
+     *
+     * The previous content of `trackIDEs` is replaced, but the memory of its
+     * elements is reused.
+     */
+    void TrackIDEsBatch(std::span<TDCWindow_t const> windows,
+                        std::vector<std::vector<sim::TrackIDE>>& trackIDEs) const;
+
     /// Comparison: sorts by channel ID
     bool operator<(const SimChannel& other) const;
 
@@ -260,7 +328,8 @@ namespace sim {
      * current one.
      * This is achieved by appending the energy deposit information (`sim::IDE`)
      * at each TDC tick from the merged channel to the list of existing energy
-     * deposits for that TDC tick.
+     * deposits for that TDC tick; TDC ticks are kept sorted.
+     * The two lists of TDC ticks are merged in a single pass.
      *
      * In addition, the track IDs of the merged channel are added an offset,
      * so that they can be distinguished from the existing ones.
@@ -277,6 +346,25 @@ namespace sim {
      */
     std::pair<TrackID_t, TrackID_t> MergeSimChannel(const SimChannel& channel, int offset);
 
+    /**
+     * @brief Merges the deposits from many other channels into this one
+     * @param channels the channels holding information to be merged
+     * @param offsets track ID offset for each of the merged channels
+     * @return range of the IDs of the added tracks, one per merged channel
+     * @throw std::runtime_error if a channel has a different channel number
+     * @throw std::runtime_error if the number of offsets is not the same as
+     *        the number of channels
+     * @see MergeSimChannel()
+     *
+     * The result is the same as calling `MergeSimChannel(*channels[i],
+     * offsets[i])` for each channel in order, but all the channels are merged
+     * in a single pass over their TDC ticks.
+     * This is useful to overlay many samples (e.g. pile-up) into one channel.
+     */
+    std::vector<std::pair<TrackID_t, TrackID_t>> MergeSimChannels(
+      std::span<SimChannel const* const> channels,
+      std::span<int const> offsets);
+
     /**
      * @brief Dumps the full content of the SimChannel into a stream
      * @tparam Stream an ostream-like stream object
@@ -306,6 +394,32 @@ namespace sim {
     /// @}
   };
 
+  namespace details {
+
+    /**
+     * @brief Adds a deposit to a list of deposits per track
+     * @param trackIDEs list of deposits, one per track, sorted by track ID
+     * @param ide the deposit to be added
+     *
+     * If `trackIDEs` already has a deposit from the track of `ide`, `ide` is
+     * merged into it (energy and electrons are added, the position is averaged
+     * with the number of electrons as weight); otherwise, a copy of `ide` is
+     * inserted keeping the list sorted.
+     * This is the aggregation used by `sim::SimChannel::TrackIDsAndEnergies()`.
+     */
+    void AddToTrackIDEs(std::vector<sim::IDE>& trackIDEs, sim::IDE const& ide);
+
+    /**
+     * @brief Fills a list of `sim::TrackIDE` from deposits aggregated by track
+     * @param ides deposits, one per track (as from `AddToTrackIDEs()`)
+     * @param trackIDEs the list to be filled (previous content is removed)
+     *
+     * This is the conversion used by `sim::SimChannel::TrackIDEs()`.
+     */
+    void FillTrackIDEs(std::vector<sim::IDE> const& ides, std::vector<sim::TrackIDE>& trackIDEs);
+
+  } // namespace details
+
 } // namespace sim
 
 inline bool sim::SimChannel::operator<(const sim::SimChannel& other) const
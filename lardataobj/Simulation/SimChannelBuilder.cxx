@@ -0,0 +1,121 @@
+/**
+ * @file   lardataobj/Simulation/SimChannelBuilder.cxx
+ * @brief  Batched filling of `sim::SimChannel` objects.
+ * @see    SimChannelBuilder.h
+ */
+
+#include "lardataobj/Simulation/SimChannelBuilder.h"
+
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::stable_sort(), std::sort()
+#include <limits>    // std::numeric_limits
+#include <numeric>   // std::iota()
+#include <utility>   // std::move(), std::pair
+
+namespace sim {
+
+  //-------------------------------------------------
+  SimChannelBuilder::SimChannelBuilder(raw::ChannelID_t channel) : fChannel(channel) {}
+
+  //-------------------------------------------------
+  void SimChannelBuilder::AddIonizationElectrons(TrackID_t trackID,
+                                                 TDC_t tdc,
+                                                 double numberElectrons,
+                                                 double const* xyz,
+                                                 double energy,
+                                                 TrackID_t origTrackID)
+  {
+    // same check as in SimChannel::AddIonizationElectrons()
+    if ((numberElectrons < std::numeric_limits<double>::epsilon()) ||
+        (energy <= std::numeric_limits<double>::epsilon())) {
+      MF_LOG_ERROR("SimChannel") << "AddIonizationElectrons() trying to add to TDC #" << tdc << " "
+                                 << numberElectrons << " electrons with " << energy
+                                 << " MeV of energy from track ID=" << trackID;
+      return;
+    } // if no energy or no electrons
+
+    fDeposits.push_back({static_cast<SimChannel::StoredTDC_t>(tdc),
+                         trackID,
+                         origTrackID,
+                         numberElectrons,
+                         energy,
+                         xyz[0],
+                         xyz[1],
+                         xyz[2]});
+  } // SimChannelBuilder::AddIonizationElectrons()
+
+  //-------------------------------------------------
+  SimChannel SimChannelBuilder::Build() const
+  {
+    // sort the deposits by TDC and track; deposits from the same track in the
+    // same TDC keep the order they were added with
+    std::vector<std::size_t> order(fDeposits.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+      Deposit_t const& A = fDeposits[a];
+      Deposit_t const& B = fDeposits[b];
+      return (A.tdc != B.tdc) ? (A.tdc < B.tdc) : (A.origTrackID < B.origTrackID);
+    });
+
+    SimChannel::TDCIDEs_t tdcIDEs;
+
+    // merged deposits of the current TDC, with the index of their first deposit
+    std::vector<std::pair<std::size_t, sim::IDE>> tdcDeposits;
+
+    auto const flushTDC = [&tdcIDEs, &tdcDeposits](SimChannel::StoredTDC_t tdc) {
+      // IDEs are in the order their track first appeared in the TDC
+      std::sort(tdcDeposits.begin(), tdcDeposits.end(), [](auto const& a, auto const& b) {
+        return a.first < b.first;
+      });
+      std::vector<sim::IDE> ides;
+      ides.reserve(tdcDeposits.size());
+      for (auto const& tdcDeposit : tdcDeposits)
+        ides.push_back(tdcDeposit.second);
+      tdcIDEs.emplace_back(tdc, std::move(ides));
+      tdcDeposits.clear();
+    };
+
+    SimChannel::StoredTDC_t currentTDC = 0;
+    auto iOrder = order.cbegin();
+    auto const oend = order.cend();
+    while (iOrder != oend) {
+      Deposit_t const& first = fDeposits[*iOrder];
+
+      if (!tdcDeposits.empty() && (first.tdc != currentTDC)) flushTDC(currentTDC);
+      currentTDC = first.tdc;
+
+      sim::IDE ide{first.trackID,
+                   static_cast<float>(first.numElectrons),
+                   static_cast<float>(first.energy),
+                   static_cast<float>(first.x),
+                   static_cast<float>(first.y),
+                   static_cast<float>(first.z),
+                   first.origTrackID};
+      std::size_t const firstIndex = *iOrder;
+
+      // merge all the following deposits from the same track,
+      // with the same arithmetic as SimChannel::AddIonizationElectrons()
+      while ((++iOrder != oend) && (fDeposits[*iOrder].tdc == first.tdc) &&
+             (fDeposits[*iOrder].origTrackID == first.origTrackID)) {
+        Deposit_t const& deposit = fDeposits[*iOrder];
+        double weight = ide.numElectrons + deposit.numElectrons;
+        ide.x = (ide.x * ide.numElectrons + deposit.x * deposit.numElectrons) / weight;
+        ide.y = (ide.y * ide.numElectrons + deposit.y * deposit.numElectrons) / weight;
+        ide.z = (ide.z * ide.numElectrons + deposit.z * deposit.numElectrons) / weight;
+        ide.numElectrons = weight;
+        ide.energy = ide.energy + deposit.energy;
+      } // while same TDC and track
+
+      tdcDeposits.emplace_back(firstIndex, ide);
+    } // while
+
+    if (!tdcDeposits.empty()) flushTDC(currentTDC);
+
+    return SimChannel{fChannel, std::move(tdcIDEs)};
+  } // SimChannelBuilder::Build()
+
+  //-------------------------------------------------
+
+} // namespace sim
@@ -0,0 +1,108 @@
+/**
+ * @file   lardataobj/Simulation/SimChannelBuilder.h
+ * @brief  Batched filling of `sim::SimChannel` objects.
+ * @see    SimChannelBuilder.cxx
+ */
+
+#ifndef LARDATAOBJ_SIMULATION_SIMCHANNELBUILDER_H
+#define LARDATAOBJ_SIMULATION_SIMCHANNELBUILDER_H
+
+// LArSoftObj libraries
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h" // util::kBogusI
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"          // raw::ChannelID_t
+#include "lardataobj/Simulation/SimChannel.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace sim {
+
+  /**
+   * @brief Collects ionization deposits and creates a `sim::SimChannel` at once.
+   *
+   * `sim::SimChannel::AddIonizationElectrons()` keeps the deposits sorted by
+   * TDC at every call, which is expensive when a channel receives very many
+   * of them. This builder instead records each deposit in a flat list, and
+   * only when `Build()` is called it sorts them by TDC and merges them into the
+   * `sim::SimChannel` layout.
+   *
+   * The resulting `sim::SimChannel` is the same as if all the deposits had
+   * been added, in the same order, with
+   * `sim::SimChannel::AddIonizationElectrons()` to an empty channel: same TDC
+   * entries, same order of the `sim::IDE` in each TDC, and the same values
+   * (the merge follows the same order and arithmetic).
+   *
+   * Example:
+   * @code
+   * sim::SimChannelBuilder builder{channel};
+   * for (auto const& deposit: deposits)
+   *   builder.AddIonizationElectrons(deposit.trackID, deposit.tdc, ...);
+   * sim::SimChannel const simChannel = builder.Build();
+   * @endcode
+   */
+  class SimChannelBuilder {
+  public:
+    /// Type for TDC tick used in the interface.
+    using TDC_t = SimChannel::TDC_t;
+
+    /// Type of track ID (the value comes from Geant4).
+    using TrackID_t = SimChannel::TrackID_t;
+
+    /// Constructor: the deposits will be on the specified channel.
+    explicit SimChannelBuilder(raw::ChannelID_t channel);
+
+    /// Returns the readout channel of the channel being built.
+    raw::ChannelID_t Channel() const { return fChannel; }
+
+    /// Prepares memory for `n` deposits.
+    void Reserve(std::size_t n) { fDeposits.reserve(n); }
+
+    /// Returns the number of deposits recorded so far.
+    std::size_t size() const { return fDeposits.size(); }
+
+    /// Returns whether no deposit was recorded.
+    bool empty() const { return fDeposits.empty(); }
+
+    /// Removes all recorded deposits (memory is kept for reuse).
+    void Clear() { fDeposits.clear(); }
+
+    /**
+     * @brief Records ionization electrons and energy for this channel
+     * @see `sim::SimChannel::AddIonizationElectrons()`
+     *
+     * The arguments have the same meaning as in
+     * `sim::SimChannel::AddIonizationElectrons()`, and invalid deposits
+     * (no electrons or no energy) are also rejected in the same way.
+     */
+    void AddIonizationElectrons(TrackID_t trackID,
+                                TDC_t tdc,
+                                double numberElectrons,
+                                double const* xyz,
+                                double energy,
+                                TrackID_t origTrackID = util::kBogusI);
+
+    /// Returns a `sim::SimChannel` with all the recorded deposits.
+    SimChannel Build() const;
+
+  private:
+    /// A deposit as passed to `AddIonizationElectrons()`.
+    struct Deposit_t {
+      SimChannel::StoredTDC_t tdc; ///< TDC tick of the deposit
+      TrackID_t trackID;           ///< Geant4 track ID
+      TrackID_t origTrackID;       ///< Geant4 original track ID (merging key)
+      double numElectrons;         ///< number of electrons
+      double energy;               ///< energy [MeV]
+      double x;                    ///< x position of ionization [cm]
+      double y;                    ///< y position of ionization [cm]
+      double z;                    ///< z position of ionization [cm]
+    };
+
+    raw::ChannelID_t fChannel;        ///< readout channel of the deposits
+    std::vector<Deposit_t> fDeposits; ///< deposits, in order of addition
+
+  }; // class SimChannelBuilder
+
+} // namespace sim
+
+#endif // LARDATAOBJ_SIMULATION_SIMCHANNELBUILDER_H
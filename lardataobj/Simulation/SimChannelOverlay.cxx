@@ -0,0 +1,128 @@
+/**
+ * @file   lardataobj/Simulation/SimChannelOverlay.cxx
+ * @brief  Merging of whole `sim::SimChannel` collections (overlay, pile-up).
+ * @see    SimChannelOverlay.h
+ */
+
+#include "lardataobj/Simulation/SimChannelOverlay.h"
+#include "lardataobj/Utilities/ParallelChunks.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
+#include <cstddef>   // std::size_t
+#include <limits>    // std::numeric_limits
+#include <stdexcept> // std::runtime_error
+#include <string>    // std::to_string()
+
+//------------------------------------------------------------------------------
+sim::OverlaidSimChannels_t sim::OverlaySimChannels(
+  std::span<std::vector<SimChannel> const* const> inputs,
+  std::span<int const> offsets,
+  unsigned int nThreads /* = 1 */)
+{
+  if (inputs.size() != offsets.size()) {
+    throw std::runtime_error(
+      "sim::OverlaySimChannels(): the number of offsets does not match the number of inputs!");
+  }
+
+  constexpr std::size_t MinChunkSize = 16; // merged channels
+
+  // first pass: join the inputs by channel ID, and collect for each channel
+  // ID the channels from all the inputs sharing it (with their input);
+  // group `i` spans from `groupStarts[i]` to `groupStarts[i + 1]`
+  std::size_t maxChannels = 0;
+  for (std::vector<SimChannel> const* input : inputs)
+    maxChannels += input->size();
+
+  std::vector<raw::ChannelID_t> groupChannelIDs;
+  std::vector<std::size_t> groupStarts;
+  std::vector<SimChannel const*> sameChannels;
+  std::vector<int> sameOffsets;
+  std::vector<std::size_t> sameInputs;
+  groupChannelIDs.reserve(maxChannels);
+  groupStarts.reserve(maxChannels + 1);
+  sameChannels.reserve(maxChannels);
+  sameOffsets.reserve(maxChannels);
+  sameInputs.reserve(maxChannels);
+
+  std::vector<std::size_t> positions(inputs.size(), 0);
+  while (true) {
+
+    // find the next channel ID
+    SimChannel const* next = nullptr;
+    for (std::size_t iInput = 0; iInput < inputs.size(); ++iInput) {
+      std::vector<SimChannel> const& input = *inputs[iInput];
+      if (positions[iInput] >= input.size()) continue;
+      SimChannel const& channel = input[positions[iInput]];
+      if (!next || (channel < *next)) next = &channel;
+    }
+    if (!next) break;
+    raw::ChannelID_t const channelID = next->Channel();
+
+    // collect that channel from all inputs
+    groupChannelIDs.push_back(channelID);
+    groupStarts.push_back(sameChannels.size());
+    for (std::size_t iInput = 0; iInput < inputs.size(); ++iInput) {
+      std::vector<SimChannel> const& input = *inputs[iInput];
+      std::size_t& pos = positions[iInput];
+      while ((pos < input.size()) && (input[pos].Channel() == channelID)) {
+        sameChannels.push_back(&input[pos]);
+        sameOffsets.push_back(offsets[iInput]);
+        sameInputs.push_back(iInput);
+        ++pos;
+      }
+      if ((pos < input.size()) && (input[pos].Channel() < channelID)) {
+        throw std::runtime_error("sim::OverlaySimChannels(): input #" + std::to_string(iInput) +
+                                 " is not sorted by channel");
+      }
+    } // for inputs
+
+  } // while
+  groupStarts.push_back(sameChannels.size());
+
+  // second pass: merge the channels of each group, with contiguous chunks of
+  // groups processed each by its own thread, each with its own track ID ranges
+  OverlaidSimChannels_t result;
+  result.channels.reserve(groupChannelIDs.size());
+  for (raw::ChannelID_t const channelID : groupChannelIDs)
+    result.channels.emplace_back(channelID);
+
+  using TrackIDRange_t = OverlaidSimChannels_t::TrackIDRange_t;
+  TrackIDRange_t const emptyRange{std::numeric_limits<int>::max(),
+                                  std::numeric_limits<int>::min()};
+
+  std::vector<std::size_t> const bounds =
+    util::ChunkBoundaries(groupChannelIDs.size(), nThreads, MinChunkSize);
+  std::vector<std::vector<TrackIDRange_t>> chunkRanges(bounds.size() - 1);
+
+  util::ForEachChunk(bounds, [&](std::size_t iChunk, std::size_t begin, std::size_t end) {
+    std::vector<TrackIDRange_t>& trackIDranges = chunkRanges[iChunk];
+    trackIDranges.assign(inputs.size(), emptyRange);
+    for (std::size_t iGroup = begin; iGroup < end; ++iGroup) {
+      std::size_t const first = groupStarts[iGroup];
+      std::size_t const count = groupStarts[iGroup + 1] - first;
+      auto const ranges =
+        result.channels[iGroup].MergeSimChannels(std::span(sameChannels).subspan(first, count),
+                                                 std::span(sameOffsets).subspan(first, count));
+      for (std::size_t i = 0; i < ranges.size(); ++i) {
+        auto& range = trackIDranges[sameInputs[first + i]];
+        range.first = std::min(range.first, ranges[i].first);
+        range.second = std::max(range.second, ranges[i].second);
+      }
+    } // for groups
+  });
+
+  // finally, the track ID ranges of each input are reduced over the chunks
+  result.trackIDranges.assign(inputs.size(), emptyRange);
+  for (std::vector<TrackIDRange_t> const& trackIDranges : chunkRanges) {
+    for (std::size_t iInput = 0; iInput < inputs.size(); ++iInput) {
+      auto& range = result.trackIDranges[iInput];
+      range.first = std::min(range.first, trackIDranges[iInput].first);
+      range.second = std::max(range.second, trackIDranges[iInput].second);
+    }
+  }
+
+  return result;
+} // sim::OverlaySimChannels()
+
+//------------------------------------------------------------------------------
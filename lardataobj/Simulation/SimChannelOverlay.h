@@ -0,0 +1,72 @@
+/**
+ * @file   lardataobj/Simulation/SimChannelOverlay.h
+ * @brief  Merging of whole `sim::SimChannel` collections (overlay, pile-up).
+ * @see    SimChannelOverlay.cxx
+ */
+
+#ifndef LARDATAOBJ_SIMULATION_SIMCHANNELOVERLAY_H
+#define LARDATAOBJ_SIMULATION_SIMCHANNELOVERLAY_H
+
+// LArSoftObj libraries
+#include "lardataobj/Simulation/SimChannel.h"
+
+// C/C++ standard libraries
+#include <span>
+#include <utility> // std::pair
+#include <vector>
+
+namespace sim {
+
+  /// Result of `OverlaySimChannels()`.
+  struct OverlaidSimChannels_t {
+
+    /// Type of range of track IDs (lowest and highest).
+    using TrackIDRange_t = std::pair<SimChannel::TrackID_t, SimChannel::TrackID_t>;
+
+    std::vector<SimChannel> channels; ///< merged channels, sorted by channel ID
+
+    /// For each input collection, range of its track IDs after the offset.
+    std::vector<TrackIDRange_t> trackIDranges;
+
+  }; // struct OverlaidSimChannels_t
+
+  /**
+   * @brief Merges many `sim::SimChannel` collections into one
+   * @param inputs the collections to be merged
+   * @param offsets the track ID offset for each of the collections
+   * @param nThreads (default: `1`) number of threads for the merging
+   * @return the merged collection and the range of track IDs of each input
+   * @throw std::runtime_error if the number of offsets is not the same as
+   *        the number of inputs
+   * @throw std::runtime_error if an input collection is not sorted
+   * @see `sim::SimChannel::MergeSimChannels()`
+   *
+   * Each input collection must be sorted by channel ID (`operator<`).
+   * The channels with the same ID from all the inputs are merged into a
+   * single `sim::SimChannel` with `sim::SimChannel::MergeSimChannels()`,
+   * where the track IDs from the input `i` are shifted by `offsets[i]`.
+   * The deposits of a TDC tick come in the order of the inputs.
+   *
+   * The returned range for each input has the lowest and highest shifted
+   * track ID among all its channels, as in `sim::SimChannel::MergeSimChannel()`
+   * (`std::numeric_limits<int>::max()` and `min()` if the input has no
+   * deposit).
+   *
+   * The inputs are joined by channel ID in a single pass over all of them,
+   * which collects the channels to be merged for each channel ID.
+   * The groups are then merged one after the other in the calling thread.
+   * Only if the caller asks for more threads (see `util::ResolveThreads()`),
+   * the groups are split in contiguous chunks, each merged by its own thread
+   * (see `util::ForEachChunk()`), and the track ID ranges from all the chunks
+   * are finally combined; the result does not depend on the number of
+   * threads.
+   * Within a framework job, the default should be kept: a module can still
+   * split the channels among its own tasks.
+   */
+  OverlaidSimChannels_t OverlaySimChannels(std::span<std::vector<SimChannel> const* const> inputs,
+                                           std::span<int const> offsets,
+                                           unsigned int nThreads = 1);
+
+} // namespace sim
+
+#endif // LARDATAOBJ_SIMULATION_SIMCHANNELOVERLAY_H
@@ -0,0 +1,75 @@
+/**
+ * @file   lardataobj/Simulation/SimChannelRangeSums.cxx
+ * @brief  Charge and energy of a `sim::SimChannel` in TDC ranges.
+ * @see    SimChannelRangeSums.h
+ */
+
+#include "lardataobj/Simulation/SimChannelRangeSums.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::lower_bound(), std::upper_bound()
+
+namespace sim {
+
+  //-------------------------------------------------
+  SimChannelRangeSums::SimChannelRangeSums(SimChannel const& simChannel) : fSimChannel(&simChannel)
+  {}
+
+  //-------------------------------------------------
+  SimChannelRangeSums::SimChannelRangeSums(SimChannelRangeSums const& other)
+    : SimChannelRangeSums(*other.fSimChannel)
+  {}
+
+  //-------------------------------------------------
+  double SimChannelRangeSums::ChargeInRange(TDC_t startTDC, TDC_t endTDC) const
+  {
+    computeSums();
+    return sumInRange(fChargeSums, startTDC, endTDC);
+  }
+
+  //-------------------------------------------------
+  double SimChannelRangeSums::EnergyInRange(TDC_t startTDC, TDC_t endTDC) const
+  {
+    computeSums();
+    return sumInRange(fEnergySums, startTDC, endTDC);
+  }
+
+  //-------------------------------------------------
+  void SimChannelRangeSums::computeSums() const
+  {
+    std::call_once(fSumsComputed, [this]() {
+      auto const& tdcIDEs = fSimChannel->TDCIDEMap();
+
+      fTDCs.reserve(tdcIDEs.size());
+      fChargeSums.reserve(tdcIDEs.size() + 1);
+      fEnergySums.reserve(tdcIDEs.size() + 1);
+
+      double charge = 0., energy = 0.;
+      fChargeSums.push_back(charge);
+      fEnergySums.push_back(energy);
+      for (auto const& [tdc, ides] : tdcIDEs) {
+        fTDCs.push_back(tdc);
+        for (sim::IDE const& ide : ides) {
+          charge += ide.numElectrons;
+          energy += ide.energy;
+        }
+        fChargeSums.push_back(charge);
+        fEnergySums.push_back(energy);
+      } // for TDC
+    });
+  } // SimChannelRangeSums::computeSums()
+
+  //-------------------------------------------------
+  double SimChannelRangeSums::sumInRange(std::vector<double> const& sums,
+                                         TDC_t startTDC,
+                                         TDC_t endTDC) const
+  {
+    if (startTDC > endTDC) return 0.;
+    auto const first = std::lower_bound(fTDCs.begin(), fTDCs.end(), startTDC);
+    auto const last = std::upper_bound(first, fTDCs.end(), endTDC);
+    return sums[last - fTDCs.begin()] - sums[first - fTDCs.begin()];
+  } // SimChannelRangeSums::sumInRange()
+
+  //-------------------------------------------------
+
+} // namespace sim
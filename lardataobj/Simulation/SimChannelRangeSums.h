@@ -0,0 +1,95 @@
+/**
+ * @file   lardataobj/Simulation/SimChannelRangeSums.h
+ * @brief  Charge and energy of a `sim::SimChannel` in TDC ranges.
+ * @see    SimChannelRangeSums.cxx
+ */
+
+#ifndef LARDATAOBJ_SIMULATION_SIMCHANNELRANGESUMS_H
+#define LARDATAOBJ_SIMULATION_SIMCHANNELRANGESUMS_H
+
+// LArSoftObj libraries
+#include "lardataobj/Simulation/SimChannel.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <mutex>   // std::once_flag
+#include <vector>
+
+namespace sim {
+
+  /**
+   * @brief Total charge and energy of a `sim::SimChannel` in TDC ranges.
+   *
+   * Summing the charge or energy of a channel over a range of TDC ticks with
+   * `sim::SimChannel::Charge()` requires one call per tick, each looping
+   * through the deposits of that tick.
+   * This object keeps the cumulative sums of charge and energy of all the TDC
+   * ticks of a channel, so that the total in any range is obtained with two
+   * binary searches.
+   *
+   * The sums are computed only at the first query, and that computation is
+   * thread-safe: the same object can be queried concurrently.
+   * The object refers to the channel it is constructed with, which must
+   * outlive it and must not be modified after the first query.
+   *
+   * Since the result in a range is the difference of two cumulative sums, it
+   * may differ from the direct sum of `sim::SimChannel::Charge()` by rounding.
+   *
+   * The object can be copied, but the copy computes the sums again.
+   */
+  class SimChannelRangeSums {
+  public:
+    /// Type for TDC tick used in the interface.
+    using TDC_t = SimChannel::TDC_t;
+
+    /// Constructor: will compute the sums of the specified channel.
+    explicit SimChannelRangeSums(SimChannel const& simChannel);
+
+    /// Copy constructor: refers to the same channel, sums are computed again.
+    SimChannelRangeSums(SimChannelRangeSums const& other);
+
+    SimChannelRangeSums& operator=(SimChannelRangeSums const&) = delete;
+
+    /// Returns the channel the sums are computed on.
+    SimChannel const& Channel() const { return *fSimChannel; }
+
+    /**
+     * @brief Returns the total number of ionization electrons in a TDC range
+     * @param startTDC TDC tick opening the range
+     * @param endTDC TDC tick closing the range (included in the interval)
+     * @return total electrons, `0` if the range is empty
+     */
+    double ChargeInRange(TDC_t startTDC, TDC_t endTDC) const;
+
+    /**
+     * @brief Returns the total deposited energy in a TDC range [MeV]
+     * @param startTDC TDC tick opening the range
+     * @param endTDC TDC tick closing the range (included in the interval)
+     * @return total energy, `0` if the range is empty
+     */
+    double EnergyInRange(TDC_t startTDC, TDC_t endTDC) const;
+
+  private:
+    SimChannel const* fSimChannel; ///< the channel the sums are computed on
+
+    mutable std::once_flag fSumsComputed; ///< whether the sums are available
+
+    mutable std::vector<SimChannel::StoredTDC_t> fTDCs; ///< TDC ticks with signal
+
+    /// Electrons in all TDC ticks before each one (one extra entry).
+    mutable std::vector<double> fChargeSums;
+
+    /// Energy in all TDC ticks before each one (one extra entry) [MeV].
+    mutable std::vector<double> fEnergySums;
+
+    /// Computes the sums (only the first time).
+    void computeSums() const;
+
+    /// Returns the difference of `sums` at the borders of a TDC range.
+    double sumInRange(std::vector<double> const& sums, TDC_t startTDC, TDC_t endTDC) const;
+
+  }; // class SimChannelRangeSums
+
+} // namespace sim
+
+#endif // LARDATAOBJ_SIMULATION_SIMCHANNELRANGESUMS_H
@@ -0,0 +1,130 @@
+/**
+ * @file   lardataobj/Simulation/SimChannelTrackIndex.cxx
+ * @brief  Index of the energy deposits of each track in a `sim::SimChannel` collection.
+ * @see    SimChannelTrackIndex.h
+ */
+
+#include "lardataobj/Simulation/SimChannelTrackIndex.h"
+#include "lardataobj/Utilities/ParallelChunks.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::lower_bound(), std::max(), std::sort(), std::unique()
+#include <numeric>   // std::accumulate()
+
+namespace sim {
+
+  //-------------------------------------------------
+  SimChannelTrackIndex::SimChannelTrackIndex(std::vector<SimChannel> const& channels,
+                                             TrackKey_t key /* = TrackKey_t::TrackID */,
+                                             unsigned int nThreads /* = 1 */)
+    : fKey(key)
+  {
+    constexpr std::size_t MinChunkSize = 64; // channels
+
+    auto const trackOf = [key](sim::IDE const& ide) -> TrackID_t {
+      return (key == TrackKey_t::TrackID) ? ide.trackID : ide.origTrackID;
+    };
+
+    // the channels are split in contiguous chunks, each processed by a thread
+    std::vector<std::size_t> bounds =
+      util::ChunkBoundaries(channels.size(), nThreads, MinChunkSize);
+    std::size_t nChunks = bounds.size() - 1;
+
+    // the sorted track IDs of each chunk, merged into the full list
+    std::vector<std::vector<TrackID_t>> chunkTrackIDs(nChunks);
+    std::vector<std::size_t> chunkDeposits(nChunks, 0);
+    util::ForEachChunk(bounds, [&](std::size_t iChunk, std::size_t begin, std::size_t end) {
+      std::vector<TrackID_t>& trackIDs = chunkTrackIDs[iChunk];
+      for (std::size_t iChannel = begin; iChannel < end; ++iChannel) {
+        for (auto const& tdcIDE : channels[iChannel].TDCIDEMap()) {
+          for (sim::IDE const& ide : tdcIDE.second)
+            trackIDs.push_back(trackOf(ide));
+        }
+      }
+      chunkDeposits[iChunk] = trackIDs.size();
+      std::sort(trackIDs.begin(), trackIDs.end());
+      trackIDs.erase(std::unique(trackIDs.begin(), trackIDs.end()), trackIDs.end());
+    });
+    for (std::vector<TrackID_t> const& trackIDs : chunkTrackIDs)
+      fTrackIDs.insert(fTrackIDs.end(), trackIDs.begin(), trackIDs.end());
+    std::sort(fTrackIDs.begin(), fTrackIDs.end());
+    fTrackIDs.erase(std::unique(fTrackIDs.begin(), fTrackIDs.end()), fTrackIDs.end());
+    chunkTrackIDs.clear();
+
+    auto const trackIndex = [this](TrackID_t trackID) -> std::size_t {
+      return std::lower_bound(fTrackIDs.begin(), fTrackIDs.end(), trackID) - fTrackIDs.begin();
+    };
+
+    // each chunk has a counter for each track: chunks are merged so that all
+    // the counters together take no more than the deposits themselves
+    std::size_t const nTracks = fTrackIDs.size();
+    std::size_t const nDeposits =
+      std::accumulate(chunkDeposits.begin(), chunkDeposits.end(), std::size_t{0});
+    std::size_t const maxChunks =
+      std::max<std::size_t>(nDeposits / std::max<std::size_t>(nTracks, 1), 1);
+    if (nChunks > maxChunks) {
+      bounds = util::ChunkBoundaries(
+        channels.size(), static_cast<unsigned int>(maxChunks), MinChunkSize);
+      nChunks = bounds.size() - 1;
+    }
+
+    // counting sort: number of deposits of each track in each chunk...
+    std::vector<std::vector<std::size_t>> positions(nChunks);
+    util::ForEachChunk(bounds, [&](std::size_t iChunk, std::size_t begin, std::size_t end) {
+      std::vector<std::size_t>& counts = positions[iChunk];
+      counts.assign(nTracks, 0);
+      for (std::size_t iChannel = begin; iChannel < end; ++iChannel) {
+        for (auto const& tdcIDE : channels[iChannel].TDCIDEMap()) {
+          for (sim::IDE const& ide : tdcIDE.second)
+            ++counts[trackIndex(trackOf(ide))];
+        }
+      }
+    });
+
+    // ... turned into the first position of each track in each chunk: the
+    // deposits of a chunk go after the ones of the same track from the
+    // previous chunks, so that they stay in channel, TDC and deposit order...
+    fOffsets.assign(nTracks + 1, 0);
+    std::size_t position = 0;
+    for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+      fOffsets[iTrack] = position;
+      for (std::vector<std::size_t>& counts : positions) {
+        std::size_t const count = counts[iTrack];
+        counts[iTrack] = position;
+        position += count;
+      }
+    }
+    fOffsets[nTracks] = position;
+
+    // ... and each deposit is placed at its position
+    fDeposits.resize(position);
+    util::ForEachChunk(bounds, [&](std::size_t iChunk, std::size_t begin, std::size_t end) {
+      std::vector<std::size_t>& nextPositions = positions[iChunk];
+      for (std::size_t iChannel = begin; iChannel < end; ++iChannel) {
+        for (auto const& [tdc, ides] : channels[iChannel].TDCIDEMap()) {
+          for (std::size_t iIDE = 0; iIDE < ides.size(); ++iIDE) {
+            sim::IDE const& ide = ides[iIDE];
+            fDeposits[nextPositions[trackIndex(trackOf(ide))]++] = {
+              static_cast<unsigned int>(iChannel),
+              tdc,
+              static_cast<unsigned int>(iIDE),
+              ide.numElectrons};
+          } // for IDE
+        }   // for TDC
+      }     // for channels
+    });
+
+  } // SimChannelTrackIndex::SimChannelTrackIndex()
+
+  //-------------------------------------------------
+  auto SimChannelTrackIndex::Deposits(TrackID_t trackID) const -> std::span<Deposit_t const>
+  {
+    auto const itTrack = std::lower_bound(fTrackIDs.begin(), fTrackIDs.end(), trackID);
+    if ((itTrack == fTrackIDs.end()) || (*itTrack != trackID)) return {};
+    std::size_t const iTrack = itTrack - fTrackIDs.begin();
+    return {fDeposits.data() + fOffsets[iTrack], fDeposits.data() + fOffsets[iTrack + 1]};
+  } // SimChannelTrackIndex::Deposits()
+
+  //-------------------------------------------------
+
+} // namespace sim
@@ -0,0 +1,123 @@
+/**
+ * @file   lardataobj/Simulation/SimChannelTrackIndex.h
+ * @brief  Index of the energy deposits of each track in a `sim::SimChannel` collection.
+ * @see    SimChannelTrackIndex.cxx
+ */
+
+#ifndef LARDATAOBJ_SIMULATION_SIMCHANNELTRACKINDEX_H
+#define LARDATAOBJ_SIMULATION_SIMCHANNELTRACKINDEX_H
+
+// LArSoftObj libraries
+#include "lardataobj/Simulation/SimChannel.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <span>
+#include <vector>
+
+namespace sim {
+
+  /**
+   * @brief Index of the energy deposits of each track in many channels.
+   *
+   * Finding all the energy deposits of a track in a collection of
+   * `sim::SimChannel` requires scanning all the deposits of all the channels.
+   * This object scans them once, and for each track ID it keeps the list of
+   * the deposits of that track, so that they can be then looked up directly.
+   *
+   * The index can be built on the track ID (`sim::IDE::trackID`) or on the
+   * original track ID (`sim::IDE::origTrackID`).
+   * Each deposit is identified by the index of the channel in the collection,
+   * the TDC tick and the index of the deposit in the list of that tick
+   * (that is, `channels[channel].TDCIDEMap()[i].second[ide]`, where `i` is the
+   * entry with the specified TDC), and it also reports the number of
+   * electrons of the deposit.
+   * The deposits of each track are sorted by channel index, TDC and deposit
+   * index.
+   *
+   * The index does not refer to the channel collection after construction.
+   *
+   * The index is built with a counting sort by track: the deposits of each
+   * track are counted, the counts are turned into the position of the
+   * deposits of each track, and each deposit is then copied into its place.
+   * By default all of this runs in the calling thread; on request, each pass
+   * runs on contiguous chunks of channels, one per thread (see
+   * `util::ForEachChunk()`), with a result independent of the number of
+   * threads.
+   * Each chunk needs a counter per track, and fewer chunks are used when all
+   * the counters together would outnumber the deposits.
+   *
+   * Example:
+   * @code
+   * sim::SimChannelTrackIndex const index{simChannels};
+   * double electrons = 0.0;
+   * for (auto const& deposit: index.Deposits(trackID))
+   *   electrons += deposit.numElectrons;
+   * @endcode
+   */
+  class SimChannelTrackIndex {
+  public:
+    /// Type of track ID (the value comes from Geant4).
+    using TrackID_t = SimChannel::TrackID_t;
+
+    /// Track ID the index is built on.
+    enum class TrackKey_t {
+      TrackID,    ///< `sim::IDE::trackID`
+      OrigTrackID ///< `sim::IDE::origTrackID`
+    };
+
+    /// Location of an energy deposit of a track.
+    struct Deposit_t {
+      unsigned int channel;        ///< index of the channel in the collection
+      SimChannel::StoredTDC_t tdc; ///< TDC tick of the deposit
+      unsigned int ide;            ///< index of the deposit in its TDC tick
+      float numElectrons;          ///< number of electrons of the deposit
+    };
+
+    /// Default constructor: an empty index.
+    SimChannelTrackIndex() = default;
+
+    /**
+     * @brief Constructor: indexes all the deposits of the specified channels
+     * @param channels the channels to be indexed
+     * @param key the track ID the index is built on
+     * @param nThreads (default: `1`) number of threads to build the index
+     *
+     * See `util::ResolveThreads()` for the meaning of `nThreads`.
+     */
+    explicit SimChannelTrackIndex(std::vector<SimChannel> const& channels,
+                                  TrackKey_t key = TrackKey_t::TrackID,
+                                  unsigned int nThreads = 1);
+
+    /// Returns the track ID the index is built on.
+    TrackKey_t Key() const { return fKey; }
+
+    /// Returns the number of tracks with some deposit.
+    std::size_t NTracks() const { return fTrackIDs.size(); }
+
+    /// Returns the total number of deposits in the index.
+    std::size_t NDeposits() const { return fDeposits.size(); }
+
+    /// Returns the sorted list of all the tracks with some deposit.
+    std::span<TrackID_t const> TrackIDs() const { return fTrackIDs; }
+
+    /// Returns all the deposits of the specified track (empty if none).
+    std::span<Deposit_t const> Deposits(TrackID_t trackID) const;
+
+    /// Returns whether the track has any deposit.
+    bool HasTrack(TrackID_t trackID) const { return !Deposits(trackID).empty(); }
+
+  private:
+    TrackKey_t fKey = TrackKey_t::TrackID; ///< the track ID the index is built on
+    std::vector<TrackID_t> fTrackIDs;      ///< tracks with deposits, sorted
+
+    /// Index in `fDeposits` of the first deposit of each track; one extra entry.
+    std::vector<std::size_t> fOffsets{0};
+
+    std::vector<Deposit_t> fDeposits; ///< deposits of all tracks, grouped by track
+
+  }; // class SimChannelTrackIndex
+
+} // namespace sim
+
+#endif // LARDATAOBJ_SIMULATION_SIMCHANNELTRACKINDEX_H
@@ -17,6 +17,8 @@
 #include "lardataobj/Simulation/AuxDetHit.h"
 #include "lardataobj/Simulation/AuxDetSimChannel.h"
 #include "lardataobj/Simulation/BeamGateInfo.h"
+#include "lardataobj/Simulation/CompactSimChannel.h"
+#include "lardataobj/Simulation/CompactSimPhotonsLite.h"
 #include "lardataobj/Simulation/GeneratedParticleInfo.h"
 #include "lardataobj/Simulation/OpDetBacktrackerRecord.h"
 #include "lardataobj/Simulation/ParticleAncestryMap.h"
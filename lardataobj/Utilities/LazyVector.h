@@ -14,6 +14,7 @@
 // C/C++ standard libraries
 #include <algorithm>
 #include <cassert>
+#include <cstddef>   // std::size_t
 #include <stdexcept> // std::out_of_range
 #include <string>    // std::to_string()
 #include <vector>
@@ -95,6 +96,17 @@ namespace util {
     /// @}
     // --- END STL vector types ------------------------------------------------
 
+    /// Breakdown of the memory used by the vector (see `memory_usage()`).
+    struct memory_usage_t {
+      size_type n_ranges = 0;   ///< Number of ranges with storage (`0` or `1`).
+      std::size_t payload = 0;  ///< Bytes taken by the elements with storage.
+      std::size_t slack = 0;    ///< Bytes allocated but not used (capacity).
+      std::size_t overhead = 0; ///< Bytes of the vector object itself.
+
+      /// Returns the total memory used, in bytes.
+      std::size_t total() const { return payload + slack + overhead; }
+    }; // memory_usage_t
+
     /// --- BEGIN Constructors -------------------------------------------------
     /// Default constructor: an empty vector.
     LazyVector() = default;
@@ -190,6 +202,15 @@ namespace util {
      */
     const_pointer data_address(size_type pos) const;
 
+    /**
+     * @brief Returns a breakdown of the memory used by the vector.
+     * @see `shrink_to_fit()`
+     *
+     * The storage is accounted from the capacity of the underlying
+     * `std::vector`; the overhead of the allocator is not included.
+     */
+    memory_usage_t memory_usage() const;
+
     /// @}
     // --- END Container information -------------------------------------------
 
@@ -562,6 +583,18 @@ typename util::LazyVector<T, A>::const_pointer util::LazyVector<T, A>::data_addr
   return (index < data_size()) ? storage().data() + index : nullptr;
 } // util::LazyVector<T,A>::data_address()
 
+//------------------------------------------------------------------------------
+template <typename T, typename A /* = std::vector<T>::allocator_type */>
+auto util::LazyVector<T, A>::memory_usage() const -> memory_usage_t
+{
+  memory_usage_t usage;
+  usage.n_ranges = data_empty() ? 0U : 1U;
+  usage.payload = data_size() * sizeof(value_type);
+  usage.slack = (storage().capacity() - data_size()) * sizeof(value_type);
+  usage.overhead = sizeof(*this);
+  return usage;
+} // util::LazyVector<T,A>::memory_usage()
+
 //------------------------------------------------------------------------------
 template <typename T, typename A /* = std::vector<T>::allocator_type */>
 void util::LazyVector<T, A>::resize(size_type newSize)
@@ -0,0 +1,120 @@
+/**
+ * @file   lardataobj/Utilities/ParallelChunks.h
+ * @brief  Processing of a range of indices in contiguous chunks, one thread each.
+ *
+ * This is a header-only library.
+ *
+ * The algorithms of `lardataobj` which run on more than one thread split
+ * their work in contiguous chunks of indices with `util::ChunkBoundaries()`
+ * and process each chunk in its own `std::thread` with
+ * `util::ForEachChunk()`.
+ * They all take the number of threads as argument, and the result never
+ * depends on it.
+ * The default is `1`, which does all the work in the calling thread without
+ * starting any other: a job running in a framework with its own scheduler
+ * (like _art_) or on a single-core slot should keep it, and leave the
+ * parallelism to the framework.
+ * Larger values, or `0` for the number of hardware threads
+ * (`util::ResolveThreads()`), must be explicitly requested by the caller.
+ */
+
+#ifndef LARDATAOBJ_UTILITIES_PARALLELCHUNKS_H
+#define LARDATAOBJ_UTILITIES_PARALLELCHUNKS_H
+
+// C/C++ standard libraries
+#include <algorithm>    // std::min(), std::max()
+#include <cstddef>      // std::size_t
+#include <exception>    // std::exception_ptr, std::current_exception()
+#include <span>
+#include <system_error> // std::system_error
+#include <thread>
+#include <vector>
+
+namespace util {
+
+  /// Returns `nThreads`, or the number of hardware threads if `0` (at least `1`).
+  inline unsigned int ResolveThreads(unsigned int nThreads)
+  {
+    if (nThreads > 0) return nThreads;
+    return std::max(std::thread::hardware_concurrency(), 1U);
+  }
+
+  /**
+   * @brief Splits the indices from `0` to `n` into contiguous chunks.
+   * @param n the number of indices
+   * @param nThreads the number of threads (`0`: see `ResolveThreads()`)
+   * @param minChunkSize the minimum number of indices in a chunk
+   * @return the boundaries of the chunks
+   *
+   * The returned list has one element more than the number of chunks:
+   * chunk `i` spans from index `bounds[i]` to `bounds[i + 1]` (excluded).
+   * There are at most as many chunks as threads, all with about the same
+   * size and at least `minChunkSize` indices; there is always at least one
+   * chunk, possibly empty.
+   */
+  inline std::vector<std::size_t> ChunkBoundaries(std::size_t n,
+                                                  unsigned int nThreads,
+                                                  std::size_t minChunkSize = 1)
+  {
+    std::size_t nChunks = std::min<std::size_t>(ResolveThreads(nThreads),
+                                                 n / std::max<std::size_t>(minChunkSize, 1));
+    nChunks = std::max<std::size_t>(nChunks, 1);
+
+    std::vector<std::size_t> bounds(nChunks + 1);
+    for (std::size_t i = 0; i <= nChunks; ++i)
+      bounds[i] = n / nChunks * i + std::min(n % nChunks, i);
+    return bounds;
+  } // ChunkBoundaries()
+
+  /**
+   * @brief Calls `f(iChunk, begin, end)` for each chunk, each in its own thread.
+   * @param bounds the boundaries of the chunks (see `ChunkBoundaries()`)
+   * @param f the function to be called
+   *
+   * The first chunk is processed in the calling thread, and the function
+   * returns after all the chunks are processed; if a thread can't be started,
+   * its chunk is processed in the calling thread too.
+   * If any of the calls throws, the exception from the first such chunk is
+   * rethrown after all the threads are completed.
+   */
+  template <typename F>
+  void ForEachChunk(std::span<std::size_t const> bounds, F&& f)
+  {
+    std::size_t const nChunks = bounds.empty() ? 0 : bounds.size() - 1;
+    if (nChunks == 0) return;
+    if (nChunks == 1) {
+      f(std::size_t{0}, bounds[0], bounds[1]);
+      return;
+    }
+
+    std::vector<std::exception_ptr> errors(nChunks);
+    auto const run = [&f, &errors, bounds](std::size_t iChunk) {
+      try {
+        f(iChunk, bounds[iChunk], bounds[iChunk + 1]);
+      }
+      catch (...) {
+        errors[iChunk] = std::current_exception();
+      }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nChunks - 1);
+    for (std::size_t iChunk = 1; iChunk < nChunks; ++iChunk) {
+      try {
+        threads.emplace_back(run, iChunk);
+      }
+      catch (std::system_error const&) { // no more threads available
+        run(iChunk);
+      }
+    }
+    run(0);
+    for (std::thread& thread : threads)
+      thread.join();
+
+    for (std::exception_ptr const& error : errors)
+      if (error) std::rethrow_exception(error);
+  } // ForEachChunk()
+
+} // namespace util
+
+#endif // LARDATAOBJ_UTILITIES_PARALLELCHUNKS_H
@@ -0,0 +1,181 @@
+/**
+ * @file    lardataobj/Utilities/compact_float.h
+ * @brief   Conversions of `float` values to and from 16-bit representations.
+ *
+ * This is a header-only library.
+ *
+ * Three 16-bit representations are supported:
+ *  * IEEE 754 half precision (`binary16`): 11 bits of precision, range up to
+ *    65504; values beyond the range become infinity;
+ *  * "brain" floating point (`bfloat16`): the same range as `float`, 8 bits
+ *    of precision;
+ *  * integer scaled by a common factor (`scaled_int16`): each value is stored
+ *    as an integer multiple of a scale chosen so that the largest value of
+ *    the set is represented by `32767`; the absolute precision is the same
+ *    for all the values in the set.
+ *
+ * Conversions to 16 bits round to nearest.
+ * The bulk conversion functions are plain loops over contiguous data using
+ * only integer and floating point arithmetic, which the compiler can
+ * vectorize for the target architecture (e.g. `-mf16c` is not required).
+ */
+
+#ifndef LARDATAOBJ_UTILITIES_COMPACT_FLOAT_H
+#define LARDATAOBJ_UTILITIES_COMPACT_FLOAT_H
+
+// C/C++ standard library
+#include <algorithm> // std::max(), std::clamp(), std::fill_n()
+#include <bit>       // std::bit_cast()
+#include <cassert>
+#include <cmath>   // std::abs(), std::nearbyint()
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint16_t, std::int16_t, std::uint32_t
+#include <span>
+
+namespace lar::compact {
+
+  // ---------------------------------------------------------------------------
+  /// Returns the IEEE 754 half precision representation of `value`.
+  inline std::uint16_t float_to_half(float value)
+  {
+    constexpr std::uint32_t f32infty = 255U << 23;
+    constexpr std::uint32_t f16max = (127U + 16U) << 23;
+    constexpr std::uint32_t denormMagicBits = ((127U - 15U) + (23U - 10U) + 1U) << 23;
+    constexpr float denormMagic = std::bit_cast<float>(denormMagicBits);
+
+    std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+    std::uint32_t const sign = bits & 0x80000000U;
+    bits ^= sign;
+
+    std::uint16_t half;
+    if (bits >= f16max) // too large: infinity, or NaN
+      half = (bits > f32infty) ? 0x7E00U : 0x7C00U;
+    else if (bits < (113U << 23)) { // subnormal or zero: let the FPU round
+      float const shifted = std::bit_cast<float>(bits) + denormMagic;
+      half = static_cast<std::uint16_t>(std::bit_cast<std::uint32_t>(shifted) - denormMagicBits);
+    }
+    else { // normal: rebias the exponent and round the mantissa to even
+      std::uint32_t const mantissaOdd = (bits >> 13) & 1U;
+      bits += ((15U - 127U) << 23) + 0xFFFU + mantissaOdd;
+      half = static_cast<std::uint16_t>(bits >> 13);
+    }
+    return half | static_cast<std::uint16_t>(sign >> 16);
+  } // float_to_half()
+
+  /// Returns the `float` value of the IEEE 754 half precision `half`.
+  inline float half_to_float(std::uint16_t half)
+  {
+    constexpr std::uint32_t shiftedExp = 0x7C00U << 13;
+    constexpr float subnormalBias = std::bit_cast<float>(113U << 23);
+
+    std::uint32_t bits = std::uint32_t(half & 0x7FFFU) << 13;
+    std::uint32_t const exp = bits & shiftedExp;
+    bits += (127U - 15U) << 23;
+    if (exp == shiftedExp) // infinity or NaN
+      bits += (128U - 16U) << 23;
+    else if (exp == 0) { // subnormal or zero: renormalize
+      bits += 1U << 23;
+      bits = std::bit_cast<std::uint32_t>(std::bit_cast<float>(bits) - subnormalBias);
+    }
+    bits |= std::uint32_t(half & 0x8000U) << 16;
+    return std::bit_cast<float>(bits);
+  } // half_to_float()
+
+  // ---------------------------------------------------------------------------
+  /// Returns the `bfloat16` representation of `value`.
+  inline std::uint16_t float_to_bfloat16(float value)
+  {
+    std::uint32_t const bits = std::bit_cast<std::uint32_t>(value);
+    if ((bits & 0x7FFFFFFFU) > 0x7F800000U) // NaN: keep it quiet
+      return static_cast<std::uint16_t>((bits >> 16) | 0x0040U);
+    std::uint32_t const rounding = 0x7FFFU + ((bits >> 16) & 1U);
+    return static_cast<std::uint16_t>((bits + rounding) >> 16);
+  } // float_to_bfloat16()
+
+  /// Returns the `float` value of the `bfloat16` representation `bf16`.
+  inline float bfloat16_to_float(std::uint16_t bf16)
+  {
+    return std::bit_cast<float>(std::uint32_t(bf16) << 16);
+  }
+
+  // ---------------------------------------------------------------------------
+  /// @{
+  /// @name Bulk conversions
+  ///
+  /// The output must have at least as many elements as the input; only as
+  /// many elements as in the input are written.
+
+  /// Converts all `values` into half precision into `out`.
+  inline void encode_half(std::span<float const> values, std::span<std::uint16_t> out)
+  {
+    assert(out.size() >= values.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+      out[i] = float_to_half(values[i]);
+  }
+
+  /// Converts all half precision `values` into `out`.
+  inline void decode_half(std::span<std::uint16_t const> values, std::span<float> out)
+  {
+    assert(out.size() >= values.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+      out[i] = half_to_float(values[i]);
+  }
+
+  /// Converts all `values` into `bfloat16` into `out`.
+  inline void encode_bfloat16(std::span<float const> values, std::span<std::uint16_t> out)
+  {
+    assert(out.size() >= values.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+      out[i] = float_to_bfloat16(values[i]);
+  }
+
+  /// Converts all `bfloat16` `values` into `out`.
+  inline void decode_bfloat16(std::span<std::uint16_t const> values, std::span<float> out)
+  {
+    assert(out.size() >= values.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+      out[i] = bfloat16_to_float(values[i]);
+  }
+
+  /**
+   * @brief Converts all `values` into integers with a common scale.
+   * @param values the values to be converted (must be finite)
+   * @param out the buffer for the scaled values
+   * @return the scale: each value is `out[i] * scale`, within `scale / 2`
+   *
+   * If all values are `0`, the returned scale is also `0`.
+   */
+  inline float encode_scaled_int16(std::span<float const> values, std::span<std::int16_t> out)
+  {
+    assert(out.size() >= values.size());
+    float maxAbs = 0.0f;
+    for (float const value : values)
+      maxAbs = std::max(maxAbs, std::abs(value));
+    if (maxAbs == 0.0f) {
+      std::fill_n(out.begin(), values.size(), std::int16_t{0});
+      return 0.0f;
+    }
+    float const scale = maxAbs / 32767.0f;
+    float const invScale = 32767.0f / maxAbs;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      float const scaled = std::clamp(std::nearbyint(values[i] * invScale), -32767.0f, 32767.0f);
+      out[i] = static_cast<std::int16_t>(scaled);
+    }
+    return scale;
+  } // encode_scaled_int16()
+
+  /// Converts all `values` with the common `scale` into `out`.
+  inline void decode_scaled_int16(std::span<std::int16_t const> values,
+                                  float scale,
+                                  std::span<float> out)
+  {
+    assert(out.size() >= values.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+      out[i] = values[i] * scale;
+  }
+
+  /// @}
+
+} // namespace lar::compact
+
+#endif // LARDATAOBJ_UTILITIES_COMPACT_FLOAT_H
@@ -11,13 +11,16 @@
 #define LARDATAOBJ_UTILITIES_SPARSE_VECTOR_H
 
 // C/C++ standard library
-#include <algorithm> // std::upper_bound(), std::max()
-#include <cstddef>   // std::ptrdiff_t
-#include <iterator>  // std::distance()
-#include <numeric>   // std::accumulate
+#include <algorithm>  // std::upper_bound(), std::max(), std::fill_n()
+#include <cstddef>    // std::ptrdiff_t
+#include <functional> // std::plus, std::greater
+#include <iterator>   // std::distance()
+#include <numeric>    // std::accumulate
 #include <ostream>
+#include <span>
 #include <stdexcept>   // std::out_of_range()
 #include <type_traits> // std::is_integral
+#include <utility>     // std::pair, std::move()
 #include <vector>
 
 /// Namespace for generic LArSoft-related utilities.
@@ -304,6 +307,9 @@ class value_iterator: public value_const_iterator<T> {
   template <typename T>
   class sparse_vector;
 
+  template <typename T>
+  class sparse_vector_builder;
+
   namespace details {
     template <typename T>
     decltype(auto) make_const_datarange_t(typename sparse_vector<T>::datarange_t& r);
@@ -480,6 +486,8 @@ class value_iterator: public value_const_iterator<T> {
   template <typename T>
   class sparse_vector {
     typedef sparse_vector<T> this_t;
+
+    friend class sparse_vector_builder<T>;
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     //  - - - public interface
   public:
@@ -500,6 +508,7 @@ class value_iterator: public value_const_iterator<T> {
     class const_reference;
     class iterator;
     class const_iterator;
+    class const_cursor;
 
     class datarange_t;
     class const_datarange_t;
@@ -512,6 +521,17 @@ class value_iterator: public value_const_iterator<T> {
     typedef typename range_list_t::const_iterator range_const_iterator;
     ///< type of constant iterator over ranges
 
+    /// Breakdown of the memory used by a sparse vector (see `memory_usage()`)
+    struct memory_usage_t {
+      size_type n_ranges = 0;   ///< number of non-void ranges
+      std::size_t payload = 0;  ///< bytes taken by the non-void elements
+      std::size_t slack = 0;    ///< bytes allocated but not used (capacity)
+      std::size_t overhead = 0; ///< bytes of bookkeeping (object and ranges)
+
+      /// Returns the total memory used, in bytes
+      std::size_t total() const { return payload + slack + overhead; }
+    }; // memory_usage_t
+
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     //  - - - public methods
     /// Default constructor: an empty vector
@@ -565,6 +585,39 @@ class value_iterator: public value_const_iterator<T> {
     /// Destructor: default
     ~sparse_vector() = default;
 
+    //@{
+    /**
+   * @brief Creates a sparse vector from dense data, voiding the quiet regions
+   * @param data the dense data
+   * @param thr threshold at or below which (in module) a value is quiet
+   * @param padding (default: `0`) samples to keep around each non-quiet region
+   * @param pre_padding samples to keep before each non-quiet region
+   * @param post_padding samples to keep after each non-quiet region
+   * @return a sparse vector with the same size as `data`
+   * @see `sparse_vector_builder`
+   *
+   * The data values whose module is above `thr` (see `is_zero()`) are copied,
+   * together with `pre_padding` values before them and `post_padding` after
+   * them, the same way region of interest finders usually do.
+   * Regions which overlap or touch after the padding is applied are merged,
+   * and all the other values are cast into the void.
+   * The values within a range are copied as they are, even if quiet.
+   *
+   * Each range is allocated only once, and the scan for the region borders
+   * is written in blocks to be vectorized by the compiler.
+   */
+    static sparse_vector from_dense(std::span<value_type const> data,
+                                    value_type thr,
+                                    size_type padding = 0)
+    {
+      return from_dense(data, thr, padding, padding);
+    }
+    static sparse_vector from_dense(std::span<value_type const> data,
+                                    value_type thr,
+                                    size_type pre_padding,
+                                    size_type post_padding);
+    //@}
+
     //  - - - STL-like interface
     /// Removes all the data, making the vector empty
     void clear()
@@ -582,6 +635,22 @@ class value_iterator: public value_const_iterator<T> {
     /// Returns the capacity of the vector (compatibility only)
     size_type capacity() const { return nominal_size; }
 
+    /**
+   * @brief Returns a breakdown of the memory used by this vector.
+   * @return a `memory_usage_t` record
+   * @see `shrink_to_fit()`, `optimize()`
+   *
+   * The accounting includes this object, the record of each range and the
+   * storage of the data of each range (as from `std::vector` capacity: the
+   * overhead of the allocator is not included).
+   * A large `slack` is recovered by `shrink_to_fit()`, while an `overhead`
+   * comparable to the `payload` hints to many small ranges.
+   */
+    memory_usage_t memory_usage() const;
+
+    /// Reduces the allocated memory to the amount needed by the non-void data
+    void shrink_to_fit();
+
     //@{
     /// Resizes the vector to the specified size, adding void
     void resize(size_type new_size);
@@ -605,6 +674,43 @@ class value_iterator: public value_const_iterator<T> {
     /// Access to an element (read/write for non-void elements only!)
     reference operator[](size_type index);
 
+    /**
+   * @brief Returns a cursor for fast sequential read access to the elements.
+   * @return a `const_cursor` object pointing to the first range
+   * @see `const_cursor`
+   *
+   * The cursor remembers the range of the last element it accessed, making
+   * access in increasing index order (e.g. tick by tick) effectively
+   * constant time instead of a binary search per element:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * auto cursor = sv.cursor();
+   * for (std::size_t i = 0; i < sv.size(); ++i) sum += cursor[i];
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Like iterators, the cursor is invalidated by any change in the range
+   * structure of the sparse vector.
+   */
+    const_cursor cursor() const;
+
+    /**
+   * @brief Writes a sequence of elements into a dense buffer.
+   * @param out the buffer to be written; its size is the number of elements
+   * @param first (default: `0`) index of the element to be written in `out[0]`
+   * @param void_value (default: `value_zero`) value written for void cells
+   * @throw std::out_of_range if the sequence extends beyond the vector size
+   *
+   * The void stretches are filled in bulk and the data of each range is copied
+   * as a block, with no allocation and no per-element range lookup.
+   * For example, to get a dense copy of the whole vector into a buffer which
+   * can be reused:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * buffer.resize(sv.size());
+   * sv.copy_to(buffer);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+    void copy_to(std::span<value_type> out,
+                 size_type first = 0,
+                 value_type void_value = value_zero) const;
+
     //  - - - special interface
 
     ///@{ @name Cell test
@@ -939,6 +1045,78 @@ class value_iterator: public value_const_iterator<T> {
     }
     /// @}
 
+    /// @{
+    /**
+   * @brief Combines this vector with `other`, element by element.
+   * @tparam OP combination operation
+   * @param other the sparse vector to combine into this one
+   * @param op operation to be executed element by element
+   * @param void_value (default: `value_zero`) the value to use for void cells
+   * @return this object
+   * @see `merge()`
+   *
+   * This is equivalent to `*this = merge(*this, other, op, void_value)`.
+   * Compared to calling `combine_range()` for each range of `other`, the
+   * ranges of the two vectors are walked only once.
+   */
+    template <typename OP>
+    sparse_vector& combine(sparse_vector const& other, OP&& op, value_type void_value = value_zero)
+    {
+      return *this = merge(*this, other, std::forward<OP>(op), void_value);
+    }
+
+    /// Adds the content of `other` to this vector, element by element.
+    sparse_vector& operator+=(sparse_vector const& other)
+    {
+      return combine(other, std::plus<value_type>());
+    }
+    /// @}
+
+    /// @{
+    /**
+   * @brief Returns the element-by-element combination of two sparse vectors.
+   * @tparam OP combination operation
+   * @param a the sparse vector providing the first operand
+   * @param b the sparse vector providing the second operand
+   * @param op operation to be executed element by element
+   * @param void_value (default: `value_zero`) the value to use for void cells
+   * @return a new sparse vector with the combination of `a` and `b`
+   *
+   * The ranges of the result are the union of the ranges of `a` and `b`, with
+   * the ones overlapping or touching each other merged.
+   * Each cell in the result has value `op(a[i], b[i])`, where void cells
+   * of either operand are represented by `void_value`.
+   * The size of the result is the largest of the sizes of `a` and `b`.
+   *
+   * The operation takes a time linear in the number of ranges and of
+   * non-void cells, and each range of the result is allocated only once.
+   */
+    template <typename OP>
+    static sparse_vector merge(sparse_vector const& a,
+                               sparse_vector const& b,
+                               OP&& op,
+                               value_type void_value = value_zero);
+
+    /**
+   * @brief Returns the element-by-element combination of many sparse vectors.
+   * @tparam OP combination operation
+   * @param inputs pointers to all the sparse vectors to be combined
+   * @param op operation to be executed element by element
+   * @param void_value (default: `value_zero`) the value to use for void cells
+   * @return a new sparse vector with the combination of all `inputs`
+   *
+   * This is the generalization of `merge(a, b, op, void_value)` to any number
+   * of inputs: each cell of the result is `op(...op(op(v0, v1), v2)..., vN)`,
+   * where `vK` is the value of that cell in the `K`-th input, or `void_value`
+   * if that cell is void there.
+   * All the inputs are combined at once, without intermediate results.
+   */
+    template <typename OP>
+    static sparse_vector merge(std::span<sparse_vector const* const> inputs,
+                               OP&& op,
+                               value_type void_value = value_zero);
+    /// @}
+
     //@{
     /**
    * @brief Adds a sequence of elements as a range at the end of the vector.
@@ -1201,8 +1379,89 @@ class value_iterator: public value_const_iterator<T> {
     /// Extends the vector size according to the last range
     size_type fix_size();
 
+    /// Returns the sorted union of the ranges of all inputs, coalesced
+    static std::vector<range_t<size_type>> union_of_ranges(
+      std::span<sparse_vector const* const> inputs);
+
   }; // class sparse_vector<>
 
+  // -----------------------------------------------------------------------------
+  // ---  lar::sparse_vector_builder<T>
+  // ---
+  /**
+ * @brief Helper to fill a sparse vector with ranges in increasing order.
+ * @tparam T type of data stored in the vector
+ *
+ * Adding ranges with `sparse_vector::add_range()` requires a look-up of the
+ * insertion point and a check for overlaps with the existing ranges.
+ * When the ranges come already sorted, as when scanning a waveform, all this
+ * is not needed: this builder appends each range at the end of the list in
+ * constant (amortized) time, and allocates its data only once.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * lar::sparse_vector_builder<float> builder;
+ * for (auto const& roi: ROIs)
+ *   builder.add_range(roi.start, roi.samples.begin(), roi.samples.end());
+ * lar::sparse_vector<float> sv = builder.finalize(waveform.size());
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * A range starting exactly at the end of the previous one is merged into it.
+ * A range starting before that end is an error.
+ */
+  template <typename T>
+  class sparse_vector_builder {
+  public:
+    typedef sparse_vector<T> sparse_vector_t; ///< type of the vector being built
+    typedef typename sparse_vector_t::value_type value_type;
+    typedef typename sparse_vector_t::size_type size_type;
+    typedef typename sparse_vector_t::vector_t vector_t;
+
+    /// Default constructor: starts with an empty sparse vector
+    sparse_vector_builder() = default;
+
+    /// Prepares memory for the specified number of ranges
+    void reserve(std::size_t nRanges) { sv.ranges.reserve(nRanges); }
+
+    /// Returns the index after the last range added so far
+    size_type end_index() const { return sv.minimum_size(); }
+
+    /// Returns the number of ranges added so far
+    std::size_t n_ranges() const { return sv.n_ranges(); }
+
+    //@{
+    /**
+   * @brief Appends a range of data at the specified offset.
+   * @tparam ITER type of iterator
+   * @param offset where to add the elements
+   * @param first iterator to the first element to be added
+   * @param last iterator after the last element to be added
+   * @throw std::runtime_error if `offset` is before `end_index()`
+   *
+   * Adding no data is allowed, and it has no effect.
+   */
+    template <typename ITER>
+    void add_range(size_type offset, ITER first, ITER last);
+
+    /// Appends a range, using the data vector directly if possible
+    void add_range(size_type offset, vector_t&& data);
+    //@}
+
+    /**
+   * @brief Returns the sparse vector built so far, and resets the builder.
+   * @param min_size (default: 0) minimum nominal size of the vector
+   * @return the sparse vector with all the added ranges
+   *
+   * The size of the returned vector is `min_size`, or the end of the last
+   * range if larger.
+   */
+    sparse_vector_t finalize(size_type min_size = 0);
+
+  private:
+    sparse_vector_t sv; ///< the vector being built
+
+    /// Throws an exception if `offset` is before the end of the last range
+    void check_offset(size_type offset) const;
+
+  }; // class sparse_vector_builder<>
+
 } // namespace lar
 
 /**
@@ -1250,7 +1509,7 @@ public:
 
   /// Constructor: offset and data as a vector (which will be used directly)
   datarange_t(size_type offset, vector_t&& data)
-    : base_t(offset, offset + data.size()), values(data)
+    : base_t(offset, offset + data.size()), values(std::move(data))
   {}
 
   //@{
@@ -1287,6 +1546,9 @@ public:
   }
   //@}
 
+  /// Reduces the allocated memory to the amount needed by the data
+  void shrink_to_fit() { values.shrink_to_fit(); }
+
   //@{
   /// Returns the value at the specified absolute index
   value_type& operator[](size_type index) { return values[base_t::relative_index(index)]; }
@@ -1684,6 +1946,77 @@ protected:
 
 }; // class lar::sparse_vector<T>::iterator
 
+/**
+ * @brief Read-only accessor caching the range of the last accessed element.
+ *
+ * The cursor keeps track of the range that contains the last accessed index,
+ * or of the first range after it if that index was in the void (the same
+ * convention as `const_iterator`).
+ * On each access, the cached range and the one next to it are checked first;
+ * only if the requested index is in neither of them (or in the void around
+ * them), a binary search is performed, restricted to the ranges on the side
+ * of the cache where the index lies.
+ * Accessing the elements in increasing (or decreasing) order therefore takes
+ * amortized constant time, while random access stays logarithmic.
+ *
+ * The cursor is not thread-safe, and it is invalidated by any operation which
+ * changes the ranges of the sparse vector (values may be changed freely).
+ */
+template <typename T>
+class lar::sparse_vector<T>::const_cursor {
+  typedef sparse_vector<T> container_t;
+
+public:
+  typedef typename container_t::value_type value_type;
+  typedef typename container_t::size_type size_type;
+  typedef typename container_t::range_const_iterator range_const_iterator;
+
+  /// Default constructor: points to no container
+  const_cursor() : cont(nullptr), currentRange() {}
+
+  /// Constructor: points to the first range of the container
+  explicit const_cursor(const container_t& c) : cont(&c), currentRange(c.begin_range()) {}
+
+  /// Returns the value at the specified index (`value_zero` if in the void)
+  value_type operator[](size_type index);
+
+  /**
+   * @brief Returns whether the specified position is void
+   * @param index position of the cell to be tested
+   * @throw out_of_range if index is not in the vector
+   * @see `sparse_vector::is_void()`
+   */
+  bool is_void(size_type index);
+
+  /**
+   * @brief Returns an iterator to the range containing the specified index
+   * @param index absolute index of the element to be sought
+   * @return iterator to containing range, or `end_range()` if in void
+   * @see `sparse_vector::find_range_iterator()`
+   */
+  range_const_iterator find_range_iterator(size_type index);
+
+  /// Returns the number (0-based) of range containing `index`, or `n_ranges()`
+  std::size_t find_range_number(size_type index)
+  {
+    return find_range_iterator(index) - cont->begin_range();
+  }
+
+  /// Returns the cached range (may be the one after the last index accessed)
+  range_const_iterator get_current_range() const { return currentRange; }
+
+  /// Forgets the cached range, pointing back to the first one
+  void reset() { currentRange = cont->begin_range(); }
+
+protected:
+  const container_t* cont;           ///< pointer to the container
+  range_const_iterator currentRange; ///< range including the last index, or next to it
+
+  /// Moves `currentRange` to the range including `index` or the one after it
+  void seek(size_type index);
+
+}; // class lar::sparse_vector<T>::const_cursor
+
 // -----------------------------------------------------------------------------
 // ---  implementation  --------------------------------------------------------
 // -----------------------------------------------------------------------------
@@ -1732,6 +2065,39 @@ namespace lar::details {
   };
 
   // --------------------------------------------------------------------------
+  /**
+   * @brief Returns the index of the first value not quiet, starting at `pos`.
+   * @param data the values to be scanned
+   * @param pos index of the first value to be scanned
+   * @param thr threshold at or below which (in module) a value is quiet
+   * @param quiet whether to look for a quiet value instead
+   * @return the index of the first (not) quiet value, or `data.size()`
+   *
+   * The scan is performed in fixed-size blocks with no early exit, which the
+   * compiler can vectorize; only the block with a match is scanned again.
+   */
+  template <typename T>
+  std::size_t find_threshold_crossing(std::span<T const> data,
+                                      std::size_t pos,
+                                      T thr,
+                                      bool quiet)
+  {
+    constexpr std::size_t BlockSize = 16;
+    auto const isQuiet = [thr](T v) { return ((v < T{0}) ? -v : v) <= thr; };
+    std::size_t const n = data.size();
+    while (pos + BlockSize <= n) {
+      bool found = false;
+      for (std::size_t i = pos; i < pos + BlockSize; ++i)
+        found |= (isQuiet(data[i]) == quiet);
+      if (found) break;
+      pos += BlockSize;
+    } // while
+    while ((pos < n) && (isQuiet(data[pos]) != quiet))
+      ++pos;
+    return pos;
+  } // find_threshold_crossing()
+
+  // --------------------------------------------------------------------------
 
 } // namespace lar::details
 
@@ -1741,6 +2107,39 @@ namespace lar::details {
 template <typename T>
 constexpr typename lar::sparse_vector<T>::value_type lar::sparse_vector<T>::value_zero;
 
+template <typename T>
+auto lar::sparse_vector<T>::from_dense(std::span<value_type const> data,
+                                       value_type thr,
+                                       size_type pre_padding,
+                                       size_type post_padding) -> sparse_vector
+{
+  size_type const n = data.size();
+  auto const nextLoud = [data, thr](size_type pos) {
+    return details::find_threshold_crossing(data, pos, thr, false);
+  };
+  auto const nextQuiet = [data, thr](size_type pos) {
+    return details::find_threshold_crossing(data, pos, thr, true);
+  };
+  // padded borders of the region starting at the first loud value at `start`
+  auto const padBegin = [pre_padding](size_type start) {
+    return (start > pre_padding) ? start - pre_padding : 0;
+  };
+  auto const padEnd = [n, post_padding](size_type end) { return std::min(n, end + post_padding); };
+
+  sparse_vector_builder<T> builder;
+  size_type start = nextLoud(0);
+  while (start < n) {
+    size_type const begin = padBegin(start);
+    size_type stop = nextQuiet(start);
+    // absorb all the following regions which would overlap or touch this one
+    while (((start = nextLoud(stop)) < n) && (padBegin(start) <= padEnd(stop)))
+      stop = nextQuiet(start);
+    size_type const end = padEnd(stop);
+    builder.add_range(begin, data.begin() + begin, data.begin() + end);
+  } // while
+  return builder.finalize(n);
+} // lar::sparse_vector<T>::from_dense()
+
 template <typename T>
 decltype(auto) lar::sparse_vector<T>::iterate_ranges()
 {
@@ -1813,6 +2212,12 @@ inline typename lar::sparse_vector<T>::const_iterator lar::sparse_vector<T>::end
   return const_iterator(*this, typename const_iterator::special::end());
 }
 
+template <typename T>
+inline typename lar::sparse_vector<T>::const_cursor lar::sparse_vector<T>::cursor() const
+{
+  return const_cursor(*this);
+}
+
 template <typename T>
 typename lar::sparse_vector<T>::value_type lar::sparse_vector<T>::operator[](size_type index) const
 {
@@ -1865,6 +2270,51 @@ inline typename lar::sparse_vector<T>::size_type lar::sparse_vector<T>::count()
                          [](size_type s, const datarange_t& rng) { return s + rng.size(); });
 } // count()
 
+template <typename T>
+void lar::sparse_vector<T>::copy_to(std::span<value_type> out,
+                                    size_type first /* = 0 */,
+                                    value_type void_value /* = value_zero */) const
+{
+  size_type const last = first + out.size();
+  if ((last > size()) || (last < first))
+    throw std::out_of_range("sparse_vector::copy_to(): sequence beyond the end of the vector");
+
+  auto iOut = out.begin();
+  size_type pos = first;
+  for (auto iRange = find_range_iter_at_or_after(first);
+       (iRange != end_range()) && (iRange->begin_index() < last);
+       ++iRange) {
+    size_type const rangeFirst = std::max(iRange->begin_index(), pos);
+    size_type const rangeLast = std::min(iRange->end_index(), last);
+    iOut = std::fill_n(iOut, rangeFirst - pos, void_value);
+    iOut = std::copy(iRange->get_iterator(rangeFirst), iRange->get_iterator(rangeLast), iOut);
+    pos = rangeLast;
+  } // for
+  std::fill(iOut, out.end(), void_value);
+} // lar::sparse_vector<T>::copy_to()
+
+template <typename T>
+auto lar::sparse_vector<T>::memory_usage() const -> memory_usage_t
+{
+  memory_usage_t usage;
+  usage.n_ranges = n_ranges();
+  usage.overhead = sizeof(*this) + ranges.size() * sizeof(datarange_t);
+  usage.slack = (ranges.capacity() - ranges.size()) * sizeof(datarange_t);
+  for (datarange_t const& range : ranges) {
+    usage.payload += range.data().size() * sizeof(value_type);
+    usage.slack += (range.data().capacity() - range.data().size()) * sizeof(value_type);
+  }
+  return usage;
+} // lar::sparse_vector<T>::memory_usage()
+
+template <typename T>
+void lar::sparse_vector<T>::shrink_to_fit()
+{
+  for (datarange_t& range : ranges)
+    range.shrink_to_fit();
+  ranges.shrink_to_fit();
+} // lar::sparse_vector<T>::shrink_to_fit()
+
 template <typename T>
 typename lar::sparse_vector<T>::value_type& lar::sparse_vector<T>::set_at(size_type const index,
                                                                           value_type value)
@@ -2098,6 +2548,83 @@ auto lar::sparse_vector<T>::combine_range(size_type offset,
 
 } // lar::sparse_vector<T>::combine_range<ITER>()
 
+template <typename T>
+template <typename OP>
+auto lar::sparse_vector<T>::merge(sparse_vector const& a,
+                                  sparse_vector const& b,
+                                  OP&& op,
+                                  value_type void_value /* = value_zero */
+                                  ) -> sparse_vector
+{
+  sparse_vector const* const inputs[] = {&a, &b};
+  return merge(inputs, std::forward<OP>(op), void_value);
+} // lar::sparse_vector<T>::merge()
+
+template <typename T>
+template <typename OP>
+auto lar::sparse_vector<T>::merge(std::span<sparse_vector const* const> inputs,
+                                  OP&& op,
+                                  value_type void_value /* = value_zero */
+                                  ) -> sparse_vector
+{
+  /*
+   * 1) find all the ranges of the result, merging the ones from all inputs
+   * 2) for each of them, fill its data with the first input, and then combine
+   *    it with each of the other inputs in turn; each input keeps track of
+   *    the first of its ranges not yet used, so it is walked only once
+   */
+  std::vector<range_t<size_type>> const outRanges = union_of_ranges(inputs);
+
+  std::vector<range_const_iterator> iRanges;
+  iRanges.reserve(inputs.size());
+  size_type size = 0;
+  for (sparse_vector const* input : inputs) {
+    iRanges.push_back(input->begin_range());
+    size = std::max(size, input->size());
+  }
+
+  sparse_vector_builder<T> builder;
+  builder.reserve(outRanges.size());
+  for (range_t<size_type> const& outRange : outRanges) {
+    vector_t values(outRange.size(), void_value);
+    for (std::size_t iInput = 0; iInput < inputs.size(); ++iInput) {
+      bool const first = (iInput == 0);
+      range_const_iterator& iRange = iRanges[iInput];
+      range_const_iterator const rend = inputs[iInput]->end_range();
+      auto dest = values.begin();
+      size_type pos = outRange.begin_index();
+      while (pos < outRange.end_index()) {
+        // void until the next range of this input within the output range
+        size_type const next =
+          ((iRange != rend) && (iRange->begin_index() < outRange.end_index())) ?
+            iRange->begin_index() :
+            outRange.end_index();
+        if (first)
+          dest += next - pos; // already filled with void_value
+        else {
+          for (auto const dend = dest + (next - pos); dest != dend; ++dest)
+            *dest = op(*dest, void_value);
+        }
+        if (next == outRange.end_index()) break;
+        // the input range is fully contained in the output range
+        if (first)
+          dest = std::copy(iRange->begin(), iRange->end(), dest);
+        else {
+          for (value_type const& value : *iRange) {
+            *dest = op(*dest, value);
+            ++dest;
+          }
+        }
+        pos = iRange->end_index();
+        ++iRange;
+      } // while
+    }   // for inputs
+    builder.add_range(outRange.begin_index(), std::move(values));
+  } // for output ranges
+
+  return builder.finalize(size);
+} // lar::sparse_vector<T>::merge(span)
+
 template <typename T>
 void lar::sparse_vector<T>::make_void(iterator first, iterator last)
 {
@@ -2292,6 +2819,53 @@ typename lar::sparse_vector<T>::range_iterator lar::sparse_vector<T>::eat_range_
   return iRange;
 } // lar::sparse_vector<T>::eat_range_head()
 
+template <typename T>
+auto lar::sparse_vector<T>::union_of_ranges(std::span<sparse_vector const* const> inputs)
+  -> std::vector<range_t<size_type>>
+{
+  // k-way merge of the sorted range lists, using a heap of the first unused
+  // range of each input (sorted by start index, smallest on top)
+  using head_t = std::pair<size_type, std::size_t>; // (start index, input)
+  std::vector<head_t> heads;
+  std::vector<range_const_iterator> iRanges;
+  heads.reserve(inputs.size());
+  iRanges.reserve(inputs.size());
+  std::size_t nRanges = 0;
+  for (std::size_t iInput = 0; iInput < inputs.size(); ++iInput) {
+    sparse_vector const& input = *(inputs[iInput]);
+    iRanges.push_back(input.begin_range());
+    nRanges += input.n_ranges();
+    if (!input.get_ranges().empty()) heads.emplace_back(input.range(0).begin_index(), iInput);
+  }
+  std::greater<head_t> const after;
+  std::make_heap(heads.begin(), heads.end(), after);
+
+  std::vector<range_t<size_type>> result;
+  result.reserve(nRanges);
+  while (!heads.empty()) {
+    std::pop_heap(heads.begin(), heads.end(), after);
+    std::size_t const iInput = heads.back().second;
+    range_const_iterator& iRange = iRanges[iInput];
+
+    // merge with the last range if overlapping or contiguous
+    if (!result.empty() && result.back().borders(iRange->begin_index())) {
+      if (iRange->end_index() > result.back().end_index())
+        result.back().resize(iRange->end_index() - result.back().begin_index());
+    }
+    else
+      result.emplace_back(iRange->begin_index(), iRange->end_index());
+
+    if (++iRange == inputs[iInput]->end_range())
+      heads.pop_back();
+    else {
+      heads.back().first = iRange->begin_index();
+      std::push_heap(heads.begin(), heads.end(), after);
+    }
+  } // while
+
+  return result;
+} // lar::sparse_vector<T>::union_of_ranges()
+
 template <typename T>
 typename lar::sparse_vector<T>::size_type lar::sparse_vector<T>::fix_size()
 {
@@ -2509,4 +3083,122 @@ void lar::sparse_vector<T>::const_iterator::refresh_state()
 // nothing new so far
 //
 
+// -----------------------------------------------------------------------------
+// --- lar::sparse_vector_builder<T> implementation
+// ---
+template <typename T>
+template <typename ITER>
+void lar::sparse_vector_builder<T>::add_range(size_type offset, ITER first, ITER last)
+{
+  check_offset(offset);
+  if (first == last) return;
+  if (!sv.ranges.empty() && (sv.ranges.back().end_index() == offset))
+    sv.ranges.back().extend(offset, first, last);
+  else
+    sv.ranges.emplace_back(offset, first, last);
+  sv.fix_size();
+} // lar::sparse_vector_builder<T>::add_range()
+
+template <typename T>
+void lar::sparse_vector_builder<T>::add_range(size_type offset, vector_t&& data)
+{
+  check_offset(offset);
+  if (data.empty()) return;
+  if (!sv.ranges.empty() && (sv.ranges.back().end_index() == offset))
+    sv.ranges.back().extend(offset, data.begin(), data.end());
+  else
+    sv.ranges.emplace_back(offset, std::move(data));
+  sv.fix_size();
+} // lar::sparse_vector_builder<T>::add_range(vector)
+
+template <typename T>
+auto lar::sparse_vector_builder<T>::finalize(size_type min_size) -> sparse_vector_t
+{
+  if (sv.size() < min_size) sv.resize(min_size);
+  sparse_vector_t result{std::move(sv)};
+  sv.clear();
+  return result;
+} // lar::sparse_vector_builder<T>::finalize()
+
+template <typename T>
+void lar::sparse_vector_builder<T>::check_offset(size_type offset) const
+{
+  if (offset < end_index()) {
+    throw std::runtime_error("lar::sparse_vector_builder::add_range(): ranges must be added"
+                             " in increasing order and not overlapping");
+  }
+} // lar::sparse_vector_builder<T>::check_offset()
+
+// -----------------------------------------------------------------------------
+// --- lar::sparse_vector<T>::const_cursor implementation
+// ---
+template <typename T>
+typename lar::sparse_vector<T>::value_type lar::sparse_vector<T>::const_cursor::operator[](
+  size_type index)
+{
+  seek(index);
+  return ((currentRange == cont->ranges.end()) || (index < currentRange->begin_index())) ?
+           value_zero :
+           (*currentRange)[index];
+} // lar::sparse_vector<T>::const_cursor::operator[]
+
+template <typename T>
+bool lar::sparse_vector<T>::const_cursor::is_void(size_type index)
+{
+  if (cont->ranges.empty() || (index >= cont->size()))
+    throw std::out_of_range("empty sparse vector");
+  seek(index);
+  return (currentRange == cont->ranges.end()) || (index < currentRange->begin_index());
+} // lar::sparse_vector<T>::const_cursor::is_void()
+
+template <typename T>
+auto lar::sparse_vector<T>::const_cursor::find_range_iterator(size_type index)
+  -> range_const_iterator
+{
+  if (cont->ranges.empty()) throw std::out_of_range("empty sparse vector");
+  seek(index);
+  return ((currentRange == cont->ranges.end()) || (index < currentRange->begin_index())) ?
+           cont->ranges.end() :
+           currentRange;
+} // lar::sparse_vector<T>::const_cursor::find_range_iterator()
+
+template <typename T>
+void lar::sparse_vector<T>::const_cursor::seek(size_type index)
+{
+  //
+  // The cache is good if `index` is in `currentRange` or in the void just
+  // before it; we try the cached range, then its neighbours, and finally
+  // fall back to a binary search on the side of the cache `index` is in.
+  //
+  range_const_iterator const rbegin = cont->ranges.begin(), rend = cont->ranges.end();
+
+  // is `index` before the current range (or anywhere, if past the last one)?
+  if ((currentRange == rend) || (index < currentRange->end_index())) {
+    // if the previous range ends before index, the cache is still good
+    if ((currentRange == rbegin) || (std::prev(currentRange)->end_index() <= index)) return;
+    // try the previous range (backward sequential access)
+    auto const iPrev = std::prev(currentRange);
+    if (iPrev->begin_index() <= index) {
+      currentRange = iPrev;
+      return;
+    }
+    // binary search in the ranges before the current one
+    auto const iNext = std::upper_bound(
+      rbegin, iPrev, index, typename datarange_t::less_int_range(datarange_t::less));
+    currentRange =
+      ((iNext != rbegin) && (index < std::prev(iNext)->end_index())) ? std::prev(iNext) : iNext;
+    return;
+  }
+
+  // `index` is after the current range: try the next one (forward sequential)
+  auto const iNext = std::next(currentRange);
+  if ((iNext == rend) || (index < iNext->end_index())) {
+    currentRange = iNext;
+    return;
+  }
+  // binary search in the ranges after the next one
+  auto const iAfter = cont->find_next_range_iter(index, std::next(iNext));
+  currentRange = (index < std::prev(iAfter)->end_index()) ? std::prev(iAfter) : iAfter;
+} // lar::sparse_vector<T>::const_cursor::seek()
+
 #endif // LARDATAOBJ_UTILITIES_SPARSE_VECTOR_H
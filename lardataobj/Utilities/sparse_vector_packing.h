@@ -0,0 +1,131 @@
+/**
+ * @file    lardataobj/Utilities/sparse_vector_packing.h
+ * @brief   Compact serialization of a `lar::sparse_vector`.
+ * @see     lardataobj/Utilities/sparse_vector.h
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATAOBJ_UTILITIES_SPARSE_VECTOR_PACKING_H
+#define LARDATAOBJ_UTILITIES_SPARSE_VECTOR_PACKING_H
+
+// LArSoft libraries
+#include "lardataobj/Utilities/sparse_vector.h"
+
+// C/C++ standard library
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <stdexcept> // std::runtime_error
+#include <vector>
+
+namespace lar {
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Compact representation of the content of a `lar::sparse_vector`.
+   * @tparam T type of data stored in the vector
+   * @see `pack_sparse_vector()`, `unpack_sparse_vector()`
+   *
+   * The range structure is encoded in `borders` as a sequence of pairs of
+   * unsigned variable-length integers (7 bits per byte, least significant
+   * first, high bit set on all bytes but the last one): for each range, the
+   * number of void cells before it (since the end of the previous range, or
+   * since the start of the vector for the first one) and its size.
+   * The data of all the ranges is stored contiguously in `values`.
+   *
+   * Since gaps and sizes are usually small, most of the borders take two
+   * bytes per range, and the data is a single array, instead of one
+   * `std::vector` per range.
+   */
+  template <typename T>
+  struct packed_sparse_vector {
+    std::size_t size = 0;               ///< Nominal size of the sparse vector.
+    std::vector<unsigned char> borders; ///< Encoded (gap, size) of each range.
+    std::vector<T> values;              ///< Data of all the ranges, in order.
+  }; // packed_sparse_vector
+
+  // ---------------------------------------------------------------------------
+  namespace details {
+
+    /// Appends `value` to `buffer` as a variable-length unsigned integer.
+    inline void write_varint(std::vector<unsigned char>& buffer, std::uint64_t value)
+    {
+      while (value >= 0x80) {
+        buffer.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+      }
+      buffer.push_back(static_cast<unsigned char>(value));
+    } // write_varint()
+
+    /// Reads a variable-length unsigned integer starting at `pos`, moving it.
+    inline std::uint64_t read_varint(std::vector<unsigned char> const& buffer, std::size_t& pos)
+    {
+      std::uint64_t value = 0;
+      for (unsigned int shift = 0; shift < 64; shift += 7) {
+        if (pos >= buffer.size())
+          throw std::runtime_error("lar::unpack_sparse_vector(): truncated range borders");
+        unsigned char const byte = buffer[pos++];
+        value |= std::uint64_t(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return value;
+      }
+      throw std::runtime_error("lar::unpack_sparse_vector(): invalid range borders");
+    } // read_varint()
+
+  } // namespace details
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Returns the compact representation of a sparse vector.
+   * @tparam T type of data stored in the vector
+   * @param sv the sparse vector to be packed
+   * @return a `packed_sparse_vector` with the content of `sv`
+   */
+  template <typename T>
+  packed_sparse_vector<T> pack_sparse_vector(sparse_vector<T> const& sv)
+  {
+    packed_sparse_vector<T> packed;
+    packed.size = sv.size();
+    packed.borders.reserve(2 * sv.n_ranges());
+    packed.values.reserve(sv.count());
+    std::size_t last = 0;
+    for (auto const& range : sv.get_ranges()) {
+      details::write_varint(packed.borders, range.begin_index() - last);
+      details::write_varint(packed.borders, range.size());
+      packed.values.insert(packed.values.end(), range.begin(), range.end());
+      last = range.end_index();
+    }
+    return packed;
+  } // pack_sparse_vector()
+
+  /**
+   * @brief Returns the sparse vector with the content of a compact one.
+   * @tparam T type of data stored in the vector
+   * @param packed the compact representation of the vector
+   * @return the unpacked sparse vector
+   * @throw std::runtime_error if the packed content is inconsistent
+   *
+   * Each range is allocated exactly once.
+   */
+  template <typename T>
+  sparse_vector<T> unpack_sparse_vector(packed_sparse_vector<T> const& packed)
+  {
+    sparse_vector_builder<T> builder;
+    std::size_t pos = 0, last = 0;
+    auto iValue = packed.values.begin();
+    while (pos < packed.borders.size()) {
+      std::size_t const offset = last + details::read_varint(packed.borders, pos);
+      std::size_t const size = details::read_varint(packed.borders, pos);
+      if ((size == 0) || (size > std::size_t(packed.values.end() - iValue)))
+        throw std::runtime_error("lar::unpack_sparse_vector(): inconsistent range sizes");
+      builder.add_range(offset, iValue, iValue + size);
+      iValue += size;
+      last = offset + size;
+    }
+    if (iValue != packed.values.end())
+      throw std::runtime_error("lar::unpack_sparse_vector(): data left after the last range");
+    return builder.finalize(packed.size);
+  } // unpack_sparse_vector()
+
+} // namespace lar
+
+#endif // LARDATAOBJ_UTILITIES_SPARSE_VECTOR_PACKING_H
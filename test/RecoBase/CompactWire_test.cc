@@ -0,0 +1,120 @@
+/**
+ * @file    CompactWire_test.cc
+ * @brief   Tests the encoding and access of a `recob::CompactWire` object.
+ * @see     lardataobj/RecoBase/CompactWire.h
+ */
+
+// C/C++ standard library
+#include <cmath>     // std::abs()
+#include <stdexcept> // std::out_of_range, std::length_error
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE (compactwire_test)
+#include "boost/test/unit_test.hpp"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"  // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h" // geo::View_t
+#include "lardataobj/RecoBase/CompactWire.h"
+#include "lardataobj/RecoBase/Wire.h"
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+recob::Wire MakeTestWire()
+{
+  using ROI_t = recob::Wire::RegionsOfInterest_t;
+  ROI_t sigROIlist(30);
+  sigROIlist.add_range(0, ROI_t::vector_t({0.5, -1.25}));
+  sigROIlist.add_range(10, ROI_t::vector_t({3.7, 12.1, 40.2, 18.9, 2.2}));
+  sigROIlist.add_range(25, ROI_t::vector_t({-0.003, 0.0}));
+  return {sigROIlist, 12, geo::kV};
+} // MakeTestWire()
+
+void CheckEncoding(recob::Wire const& wire, recob::CompactWire::Encoding_t encoding)
+{
+  recob::CompactWire const compact(wire, encoding);
+  auto const& ROIs = wire.SignalROI();
+
+  BOOST_TEST(compact.Channel() == wire.Channel());
+  BOOST_TEST(compact.View() == wire.View());
+  BOOST_TEST(compact.NSignal() == wire.NSignal());
+  BOOST_TEST((compact.Encoding() == encoding));
+  BOOST_TEST(compact.NRanges() == ROIs.n_ranges());
+  for (std::size_t i = 0; i < ROIs.n_ranges(); ++i) {
+    BOOST_TEST(compact.RangeBegin(i) == ROIs.range(i).begin_index());
+    BOOST_TEST(compact.RangeSize(i) == ROIs.range(i).size());
+  }
+
+  // relative precision for floating point, absolute (per region) for integers
+  auto const close = [encoding](float value, float expected, float maxInRange) {
+    switch (encoding) {
+    case recob::CompactWire::Encoding_t::Half:
+      return std::abs(value - expected) <= std::abs(expected) * 0.0005f + 1e-7f;
+    case recob::CompactWire::Encoding_t::BFloat16:
+      return std::abs(value - expected) <= std::abs(expected) * 0.004f;
+    case recob::CompactWire::Encoding_t::ScaledInt16:
+      return std::abs(value - expected) <= maxInRange / 32767.0f;
+    }
+    return false;
+  };
+
+  std::vector<float> const expected = wire.Signal();
+  std::vector<float> const signal = compact.Signal();
+  BOOST_TEST(signal.size() == expected.size());
+  for (std::size_t i = 0; i < ROIs.n_ranges(); ++i) {
+    auto const& range = ROIs.range(i);
+    float maxInRange = 0.0f;
+    for (float const value : range)
+      maxInRange = std::max(maxInRange, std::abs(value));
+    for (std::size_t tick = range.begin_index(); tick < range.end_index(); ++tick)
+      BOOST_TEST(close(signal[tick], expected[tick], maxInRange));
+  }
+  for (std::size_t tick = 0; tick < signal.size(); ++tick) {
+    if (expected[tick] == 0.0f) BOOST_TEST(signal[tick] == 0.0f);
+  }
+
+  std::vector<float> range(ROIs.range(1).size());
+  compact.FillRange(1, range);
+  BOOST_TEST(range[2] == signal[12]);
+  BOOST_CHECK_THROW(compact.FillRange(compact.NRanges(), range), std::out_of_range);
+  BOOST_CHECK_THROW(compact.FillRange(1, std::span<float>(range.data(), 1)), std::length_error);
+
+  std::vector<float> buffer(wire.NSignal() - 1);
+  BOOST_CHECK_THROW(compact.FillSignal(buffer), std::length_error);
+
+  recob::Wire const decoded = compact.MakeWire();
+  BOOST_TEST(decoded.Channel() == wire.Channel());
+  BOOST_TEST(decoded.SignalROI().n_ranges() == ROIs.n_ranges());
+  BOOST_TEST(decoded.Signal() == signal, boost::test_tools::per_element());
+
+} // CheckEncoding()
+
+void CompactWireTestDefaultConstructor()
+{
+  recob::CompactWire const compact;
+  BOOST_TEST(compact.Channel() == raw::InvalidChannelID);
+  BOOST_TEST(compact.View() == geo::kUnknown);
+  BOOST_TEST(compact.NSignal() == 0U);
+  BOOST_TEST(compact.NRanges() == 0U);
+  BOOST_TEST(compact.Signal().empty());
+} // CompactWireTestDefaultConstructor()
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(CompactWireDefaultConstructor)
+{
+  CompactWireTestDefaultConstructor();
+}
+
+BOOST_AUTO_TEST_CASE(CompactWireEncodings)
+{
+  recob::Wire const wire = MakeTestWire();
+  CheckEncoding(wire, recob::CompactWire::Encoding_t::Half);
+  CheckEncoding(wire, recob::CompactWire::Encoding_t::BFloat16);
+  CheckEncoding(wire, recob::CompactWire::Encoding_t::ScaledInt16);
+}
@@ -0,0 +1,155 @@
+/**
+ * @file    HitColumns_test.cc
+ * @brief   Tests the conversion, access and selection of `recob::HitColumns`.
+ * @see     lardataobj/RecoBase/HitColumns.h
+ */
+
+// C/C++ standard library
+#include <stdexcept> // std::out_of_range
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE (hitcolumns_test)
+#include "boost/test/unit_test.hpp"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"  // raw::ChannelID_t, raw::TDCtick_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h" // geo::View_t, geo::WireID
+#include "lardataobj/RecoBase/Hit.h"
+#include "lardataobj/RecoBase/HitColumns.h"
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+std::vector<recob::Hit> MakeTestHits()
+{
+  std::vector<recob::Hit> hits;
+  for (unsigned int i = 0; i < 30; ++i) {
+    unsigned int const plane = i % 3;
+    geo::SigType_t const sigType = (plane == 2) ? geo::kCollection : geo::kInduction;
+    hits.emplace_back(100 * plane + i,                   // channel
+                      raw::TDCtick_t(10 * i),            // start_tick
+                      raw::TDCtick_t(10 * i + 8),        // end_tick
+                      10.0f * i + 4.5f,                  // peak_time
+                      0.1f * i,                          // sigma_peak_time
+                      1.5f + 0.01f * i,                  // rms
+                      float(i % 7) * 10.0f,              // peak_amplitude
+                      0.5f,                              // sigma_peak_amplitude
+                      20.0f + i,                         // summedADC
+                      30.0f + i,                         // hit_integral
+                      2.0f,                              // hit_sigma_integral
+                      short(1 + i % 2),                  // multiplicity
+                      short(i % 2),                      // local_index
+                      0.9f,                              // goodness_of_fit
+                      int(i % 4),                        // dof
+                      geo::View_t(plane),                // view
+                      sigType,                           // signal_type
+                      geo::WireID(0, 1, plane, 50 + i)); // wireID
+  }
+  hits.emplace_back(); // default hit, with an invalid wire ID
+  return hits;
+} // MakeTestHits()
+
+template <typename HitA, typename HitB>
+void CheckHit(HitA const& hit, HitB const& expected)
+{
+  BOOST_TEST(hit.Channel() == expected.Channel());
+  BOOST_TEST(hit.StartTick() == expected.StartTick());
+  BOOST_TEST(hit.EndTick() == expected.EndTick());
+  BOOST_TEST(hit.PeakTime() == expected.PeakTime());
+  BOOST_TEST(hit.SigmaPeakTime() == expected.SigmaPeakTime());
+  BOOST_TEST(hit.RMS() == expected.RMS());
+  BOOST_TEST(hit.PeakAmplitude() == expected.PeakAmplitude());
+  BOOST_TEST(hit.SigmaPeakAmplitude() == expected.SigmaPeakAmplitude());
+  BOOST_TEST(hit.SummedADC() == expected.SummedADC());
+  BOOST_TEST(hit.Integral() == expected.Integral());
+  BOOST_TEST(hit.SigmaIntegral() == expected.SigmaIntegral());
+  BOOST_TEST(hit.Multiplicity() == expected.Multiplicity());
+  BOOST_TEST(hit.LocalIndex() == expected.LocalIndex());
+  BOOST_TEST(hit.GoodnessOfFit() == expected.GoodnessOfFit());
+  BOOST_TEST(hit.DegreesOfFreedom() == expected.DegreesOfFreedom());
+  BOOST_TEST(hit.View() == expected.View());
+  BOOST_TEST(hit.SignalType() == expected.SignalType());
+  BOOST_TEST(hit.WireID() == expected.WireID());
+  BOOST_TEST(hit.WireID().isValid == expected.WireID().isValid);
+  BOOST_TEST(hit.PeakTimePlusRMS(2.0f) == expected.PeakTimePlusRMS(2.0f));
+  BOOST_TEST(hit.PeakTimeMinusRMS() == expected.PeakTimeMinusRMS());
+} // CheckHit()
+
+void HitColumnsTestConversion()
+{
+  std::vector<recob::Hit> const hits = MakeTestHits();
+  recob::HitColumns const columns{hits};
+
+  BOOST_TEST(columns.size() == hits.size());
+  BOOST_TEST(!columns.empty());
+  BOOST_TEST(columns.PeakTimes().size() == hits.size());
+  for (std::size_t i = 0; i < hits.size(); ++i) {
+    CheckHit(columns[i], hits[i]);
+    BOOST_TEST(columns[i].Index() == i);
+    BOOST_TEST(columns.Planes()[i] == hits[i].WireID().Plane);
+    BOOST_TEST(columns.Integrals()[i] == hits[i].Integral());
+  }
+  BOOST_CHECK_THROW(columns.at(hits.size()), std::out_of_range);
+
+  std::vector<recob::Hit> const back = columns.ToHits();
+  BOOST_TEST_REQUIRE(back.size() == hits.size());
+  for (std::size_t i = 0; i < hits.size(); ++i)
+    CheckHit(back[i], hits[i]);
+
+  recob::HitColumns const empty;
+  BOOST_TEST(empty.empty());
+  BOOST_TEST(empty.ToHits().empty());
+  BOOST_TEST(empty.SelectAmplitude(0.0f).empty());
+
+} // HitColumnsTestConversion()
+
+void HitColumnsTestSelection()
+{
+  std::vector<recob::Hit> const hits = MakeTestHits();
+  recob::HitColumns const columns{hits};
+
+  auto const checkSelection = [&hits](std::vector<std::size_t> const& selected, auto pass) {
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < hits.size(); ++i)
+      if (pass(hits[i])) expected.push_back(i);
+    BOOST_TEST(selected == expected, boost::test_tools::per_element());
+  };
+
+  auto const inWindow = [](recob::Hit const& hit) {
+    return (hit.PeakTime() >= 50.0f) && (hit.PeakTime() < 164.5f);
+  };
+  auto const onPlane = [](recob::Hit const& hit) {
+    return hit.WireID().isValid && (hit.WireID().Plane == 1);
+  };
+  auto const bright = [](recob::Hit const& hit) { return hit.PeakAmplitude() >= 30.0f; };
+
+  checkSelection(columns.SelectTimeWindow(50.0f, 164.5f), inWindow);
+  checkSelection(columns.SelectPlane(1), onPlane);
+  checkSelection(columns.SelectAmplitude(30.0f), bright);
+  BOOST_TEST(columns.SelectTimeWindow(50.0f, 50.0f).empty());
+
+  // chained selection
+  auto const selected = columns.SelectAmplitude(
+    30.0f, columns.SelectPlane(1, columns.SelectTimeWindow(50.0f, 164.5f)));
+  checkSelection(selected, [&](recob::Hit const& hit) {
+    return inWindow(hit) && onPlane(hit) && bright(hit);
+  });
+  BOOST_TEST(!selected.empty());
+
+} // HitColumnsTestSelection()
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(HitColumnsConversion)
+{
+  HitColumnsTestConversion();
+}
+
+BOOST_AUTO_TEST_CASE(HitColumnsSelection)
+{
+  HitColumnsTestSelection();
+}
@@ -0,0 +1,153 @@
+/**
+ * @file    HitLite_test.cc
+ * @brief   Tests the conversion of `recob::Hit` into `recob::HitLite` and back.
+ * @see     lardataobj/RecoBase/HitLite.h
+ */
+
+// C/C++ standard library
+#include <cmath> // std::abs(), std::ldexp()
+
+// Boost libraries
+#define BOOST_TEST_MODULE (hitlite_test)
+#include "boost/test/unit_test.hpp"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"  // raw::ChannelID_t, raw::TDCtick_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h" // geo::View_t, geo::WireID
+#include "lardataobj/RecoBase/Hit.h"
+#include "lardataobj/RecoBase/HitLite.h"
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+recob::Hit MakeHit(raw::TDCtick_t start_tick,
+                   raw::TDCtick_t end_tick,
+                   float peak_time,
+                   float sigma,
+                   short int multiplicity,
+                   short int local_index)
+{
+  return {42,                         // channel
+          start_tick,                 // start_tick
+          end_tick,                   // end_tick
+          peak_time,                  // peak_time
+          sigma,                      // sigma_peak_time
+          2.75f,                      // rms
+          31.25f,                     // peak_amplitude
+          sigma * 10.0f,              // sigma_peak_amplitude
+          120.5f,                     // summedADC
+          118.125f,                   // hit_integral
+          sigma * 100.0f,             // hit_sigma_integral
+          multiplicity,               // multiplicity
+          local_index,                // local_index
+          0.75f,                      // goodness_of_fit
+          3,                          // dof
+          geo::kV,                    // view
+          geo::kInduction,            // signal_type
+          geo::WireID(0, 1, 1, 234)}; // wireID
+} // MakeHit()
+
+/// Checks that `sigma` is the quantized version of `expected`.
+void CheckSigma(float sigma, float expected)
+{
+  float const minSigma = std::ldexp(1.0f, -10); // smaller values are all stored the same
+  if (expected < 0.0f)
+    BOOST_TEST(sigma == -1.0f);
+  else if (expected == 0.0f)
+    BOOST_TEST(sigma == 0.0f);
+  else if (expected < minSigma)
+    BOOST_TEST(sigma <= 1.036f * minSigma);
+  else
+    BOOST_TEST(std::abs(sigma - expected) <= 0.036f * expected);
+} // CheckSigma()
+
+void CheckHitLite(recob::HitLite const& lite, recob::Hit const& hit)
+{
+  BOOST_TEST(lite.Channel() == hit.Channel());
+  BOOST_TEST(lite.StartTick() == hit.StartTick());
+  BOOST_TEST(lite.EndTick() == hit.EndTick());
+  BOOST_TEST(lite.PeakTime() == hit.PeakTime());
+  BOOST_TEST(lite.RMS() == hit.RMS());
+  BOOST_TEST(lite.PeakAmplitude() == hit.PeakAmplitude());
+  BOOST_TEST(lite.SummedADC() == hit.SummedADC());
+  BOOST_TEST(lite.Integral() == hit.Integral());
+  BOOST_TEST(lite.Multiplicity() == hit.Multiplicity());
+  BOOST_TEST(lite.LocalIndex() == hit.LocalIndex());
+  CheckSigma(lite.SigmaPeakTime(), hit.SigmaPeakTime());
+  CheckSigma(lite.SigmaPeakAmplitude(), hit.SigmaPeakAmplitude());
+  CheckSigma(lite.SigmaIntegral(), hit.SigmaIntegral());
+
+  recob::Hit const back = lite.MakeHit(
+    hit.View(), hit.SignalType(), hit.WireID(), hit.GoodnessOfFit(), hit.DegreesOfFreedom());
+  BOOST_TEST(back.Channel() == hit.Channel());
+  BOOST_TEST(back.StartTick() == hit.StartTick());
+  BOOST_TEST(back.EndTick() == hit.EndTick());
+  BOOST_TEST(back.PeakTime() == hit.PeakTime());
+  BOOST_TEST(back.Integral() == hit.Integral());
+  BOOST_TEST(back.SigmaIntegral() == lite.SigmaIntegral());
+  BOOST_TEST(back.LocalIndex() == hit.LocalIndex());
+  BOOST_TEST(back.GoodnessOfFit() == hit.GoodnessOfFit());
+  BOOST_TEST(back.DegreesOfFreedom() == hit.DegreesOfFreedom());
+  BOOST_TEST(back.View() == hit.View());
+  BOOST_TEST(back.SignalType() == hit.SignalType());
+  BOOST_TEST(back.WireID() == hit.WireID());
+} // CheckHitLite()
+
+void HitLiteTestConversion()
+{
+  for (recob::Hit const& hit : {MakeHit(100, 120, 110.5f, 0.25f, 1, 0),
+                                MakeHit(0, 4095, 0.0f, 0.0f, 255, 254),
+                                MakeHit(-30, -10, -20.25f, 3.0f, 2, 1),
+                                MakeHit(5000, 5002, 7047.9f, 1e-6f, 0, -1),
+                                MakeHit(1000, 1001, 1000.5f, -1.0f, 3, 2)}) {
+    BOOST_TEST_CONTEXT("start tick " << hit.StartTick())
+    {
+      CheckHitLite(recob::HitLite{hit}, hit);
+    }
+  }
+
+  // a hit with default values
+  recob::Hit const defaultHit;
+  recob::HitLite const defaultLite;
+  BOOST_TEST(defaultLite.Channel() == defaultHit.Channel());
+  BOOST_TEST(defaultLite.StartTick() == defaultHit.StartTick());
+  BOOST_TEST(defaultLite.EndTick() == defaultHit.EndTick());
+  BOOST_TEST(defaultLite.SigmaPeakTime() == defaultHit.SigmaPeakTime());
+  BOOST_TEST(defaultLite.SigmaIntegral() == defaultHit.SigmaIntegral());
+  BOOST_TEST(defaultLite.Multiplicity() == defaultHit.Multiplicity());
+  BOOST_TEST(defaultLite.LocalIndex() == defaultHit.LocalIndex());
+  CheckHitLite(recob::HitLite{defaultHit}, defaultHit);
+
+} // HitLiteTestConversion()
+
+void HitLiteTestLimits()
+{
+  // no hit is rejected: long hits, ticks far from the peak and large indices
+  for (recob::Hit const& hit : {MakeHit(100, 6500, 110.5f, 0.25f, 1, 0),
+                                MakeHit(100, 120, 2200.0f, 0.25f, 1, 0),
+                                MakeHit(100, 90, 95.0f, 0.25f, 1, 0),
+                                MakeHit(-2000000, 2000000, 1e9f, 0.25f, 1, 0),
+                                MakeHit(100, 120, 110.5f, 0.25f, 32767, 32766),
+                                MakeHit(100, 120, 110.5f, 0.25f, -1, -32768)}) {
+    BOOST_TEST_CONTEXT("start tick " << hit.StartTick() << ", multiplicity "
+                                     << hit.Multiplicity())
+    {
+      CheckHitLite(recob::HitLite{hit}, hit);
+    }
+  }
+} // HitLiteTestLimits()
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(HitLiteConversion)
+{
+  HitLiteTestConversion();
+}
+
+BOOST_AUTO_TEST_CASE(HitLiteLimits)
+{
+  HitLiteTestLimits();
+}
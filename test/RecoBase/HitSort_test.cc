@@ -0,0 +1,170 @@
+/**
+ * @file    HitSort_test.cc
+ * @brief   Tests the radix sorting of hit collections.
+ * @see     lardataobj/RecoBase/HitSort.h
+ */
+
+// C/C++ standard library
+#include <algorithm> // std::stable_sort()
+#include <cstdint>   // std::uint64_t
+#include <numeric>   // std::iota()
+#include <stdexcept> // std::out_of_range
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE (hitsort_test)
+#include "boost/test/unit_test.hpp"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h" // geo::View_t, geo::WireID
+#include "lardataobj/RecoBase/Hit.h"
+#include "lardataobj/RecoBase/HitColumns.h"
+#include "lardataobj/RecoBase/HitSort.h"
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+/// Creates unsorted hits, with repeated channels and times, negative times.
+std::vector<recob::Hit> MakeTestHits()
+{
+  std::vector<recob::Hit> hits;
+  for (unsigned int i = 0; i < 500; ++i) {
+    raw::ChannelID_t const channel = (i * 7919) % 97 + ((i % 5 == 0) ? 70000 : 0);
+    unsigned int const plane = channel % 3;
+    float const time = float(int((i * 31) % 41) - 10) * 0.75f;
+    hits.emplace_back(channel,                                   // channel
+                      0,                                         // start_tick
+                      1,                                         // end_tick
+                      (i % 50 == 0) ? -0.0f : time,              // peak_time
+                      0.5f,                                      // sigma_peak_time
+                      1.0f,                                      // rms
+                      float(i),                                  // peak_amplitude
+                      0.5f,                                      // sigma_peak_amplitude
+                      10.0f,                                     // summedADC
+                      10.0f,                                     // hit_integral
+                      1.0f,                                      // hit_sigma_integral
+                      1,                                         // multiplicity
+                      0,                                         // local_index
+                      1.0f,                                      // goodness_of_fit
+                      1,                                         // dof
+                      geo::View_t(plane),                        // view
+                      geo::kInduction,                           // signal_type
+                      geo::WireID(i % 2, i % 3, plane, channel)); // wireID
+  }
+  hits.emplace_back(); // invalid wire ID
+  return hits;
+} // MakeTestHits()
+
+/// Returns the order of `hits` from `std::stable_sort()` with `less`.
+template <typename Less>
+std::vector<std::size_t> StableSortOrder(std::vector<recob::Hit> const& hits, Less less)
+{
+  std::vector<std::size_t> order(hits.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&hits, less](std::size_t a, std::size_t b) {
+    return less(hits[a], hits[b]);
+  });
+  return order;
+} // StableSortOrder()
+
+void HitSortTestChannel()
+{
+  std::vector<recob::Hit> const hits = MakeTestHits();
+
+  auto const expected =
+    StableSortOrder(hits, [](recob::Hit const& a, recob::Hit const& b) { return a < b; });
+
+  BOOST_TEST(recob::SortedHitOrder(hits) == expected, boost::test_tools::per_element());
+  BOOST_TEST(recob::SortedHitOrder(recob::HitColumns{hits}) == expected,
+             boost::test_tools::per_element());
+
+  std::vector<recob::Hit> sorted = hits;
+  recob::SortHits(sorted);
+  BOOST_TEST_REQUIRE(sorted.size() == hits.size());
+  for (std::size_t i = 0; i < sorted.size(); ++i) // amplitude identifies the hit
+    BOOST_TEST(sorted[i].PeakAmplitude() == hits[expected[i]].PeakAmplitude());
+
+} // HitSortTestChannel()
+
+void HitSortTestWireID()
+{
+  std::vector<recob::Hit> const hits = MakeTestHits();
+
+  auto const expected = StableSortOrder(hits, [](recob::Hit const& a, recob::Hit const& b) {
+    if (a.WireID().isValid != b.WireID().isValid) return a.WireID().isValid;
+    if (a.WireID() != b.WireID()) return a.WireID() < b.WireID();
+    return a.PeakTime() < b.PeakTime();
+  });
+
+  BOOST_TEST(recob::SortedHitOrder(hits, recob::HitSortKey_t::WireID) == expected,
+             boost::test_tools::per_element());
+  BOOST_TEST(recob::SortedHitOrder(recob::HitColumns{hits}, recob::HitSortKey_t::WireID) ==
+               expected,
+             boost::test_tools::per_element());
+
+  BOOST_CHECK_THROW(recob::HitSortingKey(geo::WireID(0, 256, 0, 0), 0.0f), std::out_of_range);
+
+} // HitSortTestWireID()
+
+void HitSortTestKeys()
+{
+  BOOST_TEST(recob::HitSortingKey(1, -1.0f) < recob::HitSortingKey(1, -0.5f));
+  BOOST_TEST(recob::HitSortingKey(1, -0.5f) < recob::HitSortingKey(1, 0.0f));
+  BOOST_TEST(recob::HitSortingKey(1, -0.0f) == recob::HitSortingKey(1, 0.0f));
+  BOOST_TEST(recob::HitSortingKey(1, 0.0f) < recob::HitSortingKey(1, 1e-30f));
+  BOOST_TEST(recob::HitSortingKey(1, 1e30f) < recob::HitSortingKey(2, -1e30f));
+
+  BOOST_TEST(recob::RadixSortOrder({}).empty());
+  std::vector<std::size_t> const expected{2, 0, 3, 1};
+  BOOST_TEST(recob::RadixSortOrder({5, 7, 1, 5}) == expected, boost::test_tools::per_element());
+} // HitSortTestKeys()
+
+void HitSortTestThreads()
+{
+  // enough keys to be split among threads, with many repeated ones
+  std::vector<std::uint64_t> keys(100000);
+  std::uint64_t seed = 12345;
+  for (std::uint64_t& key : keys) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    key = (seed >> 40) * 0x100000001ULL;
+  }
+
+  std::vector<std::size_t> expected(keys.size());
+  std::iota(expected.begin(), expected.end(), 0);
+  std::stable_sort(expected.begin(), expected.end(), [&keys](std::size_t a, std::size_t b) {
+    return keys[a] < keys[b];
+  });
+
+  for (unsigned int const nThreads : {1U, 2U, 3U, 8U, 0U}) {
+    BOOST_TEST_CONTEXT("threads: " << nThreads)
+    {
+      BOOST_TEST(recob::RadixSortOrder(keys, nThreads) == expected,
+                 boost::test_tools::per_element());
+    }
+  }
+} // HitSortTestThreads()
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(HitSortKeys)
+{
+  HitSortTestKeys();
+}
+
+BOOST_AUTO_TEST_CASE(HitSortChannel)
+{
+  HitSortTestChannel();
+}
+
+BOOST_AUTO_TEST_CASE(HitSortWireID)
+{
+  HitSortTestWireID();
+}
+
+BOOST_AUTO_TEST_CASE(HitSortThreads)
+{
+  HitSortTestThreads();
+}
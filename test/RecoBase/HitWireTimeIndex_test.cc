@@ -0,0 +1,148 @@
+/**
+ * @file    HitWireTimeIndex_test.cc
+ * @brief   Tests the queries of a `recob::HitWireTimeIndex` object.
+ * @see     lardataobj/RecoBase/HitWireTimeIndex.h
+ */
+
+// C/C++ standard library
+#include <algorithm> // std::count_if(), std::sort()
+#include <cmath>     // std::isnan()
+#include <limits>
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE (hitwiretimeindex_test)
+#include "boost/test/unit_test.hpp"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h" // geo::PlaneID, geo::WireID
+#include "lardataobj/RecoBase/Hit.h"
+#include "lardataobj/RecoBase/HitColumns.h"
+#include "lardataobj/RecoBase/HitWireTimeIndex.h"
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+/// Creates hits on a few planes, not sorted, some sharing wire and time,
+/// a few with undefined time.
+std::vector<recob::Hit> MakeTestHits()
+{
+  std::vector<recob::Hit> hits;
+  for (unsigned int i = 0; i < 200; ++i) {
+    unsigned int const plane = (i * 7) % 3;
+    unsigned int const tpc = (i % 11 == 0) ? 1 : 0;
+    unsigned int const wire = (i * 13) % 17;
+    float const time = (i % 41 == 3) ? std::numeric_limits<float>::quiet_NaN() :
+                                       float((i * 37) % 50) * 2.5f;
+    hits.emplace_back(i,                                 // channel
+                      0,                                 // start_tick
+                      1,                                 // end_tick
+                      time,                              // peak_time
+                      0.5f,                              // sigma_peak_time
+                      1.0f,                              // rms
+                      10.0f,                             // peak_amplitude
+                      0.5f,                              // sigma_peak_amplitude
+                      10.0f,                             // summedADC
+                      10.0f,                             // hit_integral
+                      1.0f,                              // hit_sigma_integral
+                      1,                                 // multiplicity
+                      0,                                 // local_index
+                      1.0f,                              // goodness_of_fit
+                      1,                                 // dof
+                      geo::View_t(plane),                // view
+                      geo::kInduction,                   // signal_type
+                      geo::WireID(0, tpc, plane, wire)); // wireID
+  }
+  hits.emplace_back(); // invalid wire ID: never indexed
+  return hits;
+} // MakeTestHits()
+
+/// Returns the indices of hits in the range, by brute force.
+std::vector<std::size_t> BruteForce(std::vector<recob::Hit> const& hits,
+                                    geo::PlaneID const& plane,
+                                    unsigned int w0,
+                                    unsigned int w1,
+                                    float t0,
+                                    float t1)
+{
+  std::vector<std::size_t> selected;
+  for (std::size_t i = 0; i < hits.size(); ++i) {
+    geo::WireID const& wireID = hits[i].WireID();
+    if (!wireID.isValid || (wireID.planeID() != plane)) continue;
+    if ((wireID.Wire < w0) || (wireID.Wire > w1)) continue;
+    if (!((hits[i].PeakTime() >= t0) && (hits[i].PeakTime() <= t1))) continue;
+    selected.push_back(i);
+  }
+  return selected;
+} // BruteForce()
+
+void CheckSame(std::vector<std::size_t> result, std::vector<std::size_t> expected)
+{
+  std::sort(result.begin(), result.end());
+  BOOST_TEST(result == expected, boost::test_tools::per_element());
+} // CheckSame()
+
+void HitWireTimeIndexTestQueries()
+{
+  std::vector<recob::Hit> const hits = MakeTestHits();
+  recob::HitWireTimeIndex const index{hits};
+  recob::HitWireTimeIndex const columnIndex{recob::HitColumns{hits}};
+
+  std::size_t const nNaN = std::count_if(
+    hits.begin(), hits.end(), [](recob::Hit const& hit) { return std::isnan(hit.PeakTime()); });
+  BOOST_TEST(nNaN > 0U);
+  BOOST_TEST(index.size() == hits.size() - 1 - nNaN);
+  BOOST_TEST(columnIndex.size() == index.size());
+  BOOST_TEST(index.NHits(geo::PlaneID(0, 5, 0)) == 0U);
+
+  for (unsigned int tpc : {0U, 1U}) {
+    for (unsigned int p : {0U, 1U, 2U, 3U}) {
+      geo::PlaneID const plane{0, tpc, p};
+      BOOST_TEST(index.NHits(plane) == BruteForce(hits, plane, 0, 100, -1.0f, 1000.0f).size());
+      for (unsigned int w0 : {0U, 3U, 8U, 16U}) {
+        for (unsigned int w1 : {w0, w0 + 2, 16U, 30U}) {
+          for (float t0 : {0.0f, 10.0f, 47.5f}) {
+            for (float t1 : {t0, t0 + 2.4f, t0 + 30.0f, 200.0f}) {
+              auto const expected = BruteForce(hits, plane, w0, w1, t0, t1);
+              CheckSame(index.InRange(plane, w0, w1, t0, t1), expected);
+              CheckSame(columnIndex.InRange(plane, w0, w1, t0, t1), expected);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // hits are visited by wire, then by time
+  std::vector<std::size_t> const all = index.InRange(geo::PlaneID(0, 0, 1), 0, 100, 0.0f, 500.0f);
+  BOOST_TEST_REQUIRE(all.size() > 1U);
+  for (std::size_t i = 1; i < all.size(); ++i) {
+    recob::Hit const& prev = hits[all[i - 1]];
+    recob::Hit const& hit = hits[all[i]];
+    BOOST_TEST((prev.WireID().Wire < hit.WireID().Wire ||
+                (prev.WireID().Wire == hit.WireID().Wire && prev.PeakTime() <= hit.PeakTime())));
+  }
+
+} // HitWireTimeIndexTestQueries()
+
+void HitWireTimeIndexTestDefaultConstructor()
+{
+  recob::HitWireTimeIndex const index;
+  BOOST_TEST(index.empty());
+  BOOST_TEST(index.InRange(geo::PlaneID(0, 0, 0), 0, 100, 0.0f, 100.0f).empty());
+} // HitWireTimeIndexTestDefaultConstructor()
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(HitWireTimeIndexDefaultConstructor)
+{
+  HitWireTimeIndexTestDefaultConstructor();
+}
+
+BOOST_AUTO_TEST_CASE(HitWireTimeIndexQueries)
+{
+  HitWireTimeIndexTestQueries();
+}
@@ -0,0 +1,192 @@
+/**
+ * @file    SparseVectorStreamer_test.cc
+ * @brief   Tests the ROOT streamer of `lar::sparse_vector<float>`.
+ * @see     lardataobj/RecoBase/SparseVectorStreamer.h
+ *
+ * The dictionary of `lar::sparse_vector<float>` must be available.
+ * Since a streamer can't be uninstalled, the steps of the test are run in a
+ * fixed order from a single test case.
+ */
+
+// C/C++ standard library
+#include <cstddef> // std::size_t
+#include <memory>  // std::unique_ptr
+#include <string>
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE (sparsevectorstreamer_test)
+#include "boost/test/unit_test.hpp"
+
+// ROOT libraries
+#include "TBufferFile.h"
+#include "TClass.h"
+#include "TFile.h"
+#include "TTree.h"
+
+// LArSoft libraries
+#include "lardataobj/RecoBase/SparseVectorStreamer.h"
+#include "lardataobj/Utilities/sparse_vector.h"
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+using SparseVector_t = lar::sparse_vector<float>;
+
+SparseVector_t MakeTestVector()
+{
+  SparseVector_t sv(200);
+  sv.add_range(0, SparseVector_t::vector_t({0.5, -1.25}));
+  sv.add_range(10, SparseVector_t::vector_t({3.7, 12.1, 40.2, 18.9, 2.2}));
+  sv.add_range(150, SparseVector_t::vector_t(30, 1.5f));
+  sv.add_range(197, SparseVector_t::vector_t({-0.003, 0.0}));
+  return sv;
+} // MakeTestVector()
+
+/// Writes `sv` into a new buffer with the current streamer.
+std::vector<char> Write(SparseVector_t const& sv)
+{
+  TBufferFile buf{TBuffer::kWrite};
+  TClass::GetClass<SparseVector_t>()->Streamer(const_cast<SparseVector_t*>(&sv), buf);
+  return {buf.Buffer(), buf.Buffer() + buf.Length()};
+} // Write()
+
+/// Reads a vector from `data` with the current streamer.
+SparseVector_t Read(std::vector<char>& data)
+{
+  TBufferFile buf{TBuffer::kRead, static_cast<Int_t>(data.size()), data.data(), kFALSE};
+  SparseVector_t sv;
+  TClass::GetClass<SparseVector_t>()->Streamer(&sv, buf);
+  BOOST_TEST(static_cast<std::size_t>(buf.Length()) == data.size());
+  return sv;
+} // Read()
+
+/// Writes `vectors` in a tree into the file `fileName`.
+void WriteTree(std::string const& fileName, std::vector<SparseVector_t> const& vectors)
+{
+  std::unique_ptr<TFile> file{TFile::Open(fileName.c_str(), "RECREATE")};
+  BOOST_TEST_REQUIRE(file);
+  TTree* tree = new TTree("Vectors", "sparse vectors"); // owned by `file`
+  SparseVector_t const* sv = nullptr;
+  tree->Branch("sv", const_cast<SparseVector_t**>(&sv));
+  for (SparseVector_t const& v : vectors) {
+    sv = &v;
+    tree->Fill();
+  }
+  file->Write();
+} // WriteTree()
+
+/// Reads all the vectors from the tree in the file `fileName`.
+std::vector<SparseVector_t> ReadTree(std::string const& fileName)
+{
+  std::unique_ptr<TFile> file{TFile::Open(fileName.c_str(), "READ")};
+  BOOST_TEST_REQUIRE(file);
+  TTree* tree = file->Get<TTree>("Vectors");
+  BOOST_TEST_REQUIRE(tree);
+  SparseVector_t* sv = nullptr;
+  tree->SetBranchAddress("sv", &sv);
+  std::vector<SparseVector_t> vectors;
+  for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+    tree->GetEntry(i);
+    vectors.push_back(*sv);
+  }
+  delete sv;
+  return vectors;
+} // ReadTree()
+
+/// Replaces the `Int_t` at `pos` in `data` (big endian, as ROOT writes it).
+std::vector<char> Corrupt(std::vector<char> data, std::size_t pos, Int_t value)
+{
+  auto const bits = static_cast<UInt_t>(value);
+  for (std::size_t i = 0; i < sizeof(Int_t); ++i)
+    data[pos + i] = static_cast<char>((bits >> (8 * (sizeof(Int_t) - 1 - i))) & 0xFF);
+  return data;
+} // Corrupt()
+
+void CheckSame(SparseVector_t const& sv, SparseVector_t const& expected)
+{
+  BOOST_TEST(sv.size() == expected.size());
+  BOOST_TEST_REQUIRE(sv.n_ranges() == expected.n_ranges());
+  for (std::size_t i = 0; i < expected.n_ranges(); ++i) {
+    BOOST_TEST_CONTEXT("range #" << i)
+    {
+      BOOST_TEST(sv.range(i).begin_index() == expected.range(i).begin_index());
+      BOOST_TEST(sv.range(i).data() == expected.range(i).data(),
+                 boost::test_tools::per_element());
+    }
+  }
+} // CheckSame()
+
+/// Checks that the tree in `fileName` contains the `expected` vectors.
+void CheckTree(std::string const& fileName, std::vector<SparseVector_t> const& expected)
+{
+  std::vector<SparseVector_t> const vectors = ReadTree(fileName);
+  BOOST_TEST_REQUIRE(vectors.size() == expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    BOOST_TEST_CONTEXT("entry #" << i) { CheckSame(vectors[i], expected[i]); }
+  }
+} // CheckTree()
+
+void SparseVectorStreamerTest()
+{
+  SparseVector_t const sv = MakeTestVector();
+  SparseVector_t const empty(50);
+  std::vector<SparseVector_t> const vectors{sv, empty, SparseVector_t{}, sv};
+
+  TClass* cl = TClass::GetClass<SparseVector_t>();
+  BOOST_TEST_REQUIRE(cl);
+  BOOST_TEST_REQUIRE(cl->HasDictionary());
+
+  // the dictionary attaches the streamer, writing the member-wise layout
+  BOOST_TEST(cl->GetStreamer());
+  std::vector<char> oldData = Write(sv);
+  CheckSame(Read(oldData), sv);
+
+  WriteTree("SparseVectorStreamer_test_standard.root", vectors);
+  CheckTree("SparseVectorStreamer_test_standard.root", vectors);
+
+  // packed streamer: reads the old layout, writes and reads the packed one
+  BOOST_TEST(lar::InstallSparseVectorStreamer());
+  CheckSame(Read(oldData), sv);
+
+  std::vector<char> packedData = Write(sv);
+  BOOST_TEST(packedData.size() < oldData.size());
+  CheckSame(Read(packedData), sv);
+
+  std::vector<char> emptyData = Write(empty);
+  CheckSame(Read(emptyData), empty);
+
+  // corrupted array sizes (after byte count, version and size) are rejected
+  // and the object is skipped, leaving the vector empty
+  std::size_t const nBordersPos = sizeof(UInt_t) + sizeof(Version_t) + sizeof(ULong64_t);
+  for (Int_t const n : {-1, 1 << 30}) {
+    BOOST_TEST_CONTEXT("borders size " << n)
+    {
+      std::vector<char> corrupted = Corrupt(packedData, nBordersPos, n);
+      SparseVector_t const read = Read(corrupted);
+      BOOST_TEST(read.size() == 0U);
+      BOOST_TEST(read.n_ranges() == 0U);
+    }
+  }
+
+  WriteTree("SparseVectorStreamer_test_packed.root", vectors);
+  CheckTree("SparseVectorStreamer_test_packed.root", vectors);
+  CheckTree("SparseVectorStreamer_test_standard.root", vectors);
+
+  // streamer not writing packed: standard layout, still reads packed data
+  BOOST_TEST(lar::InstallSparseVectorStreamer(false));
+  BOOST_TEST(Write(sv) == oldData, boost::test_tools::per_element());
+  CheckSame(Read(packedData), sv);
+  CheckSame(Read(oldData), sv);
+
+  CheckTree("SparseVectorStreamer_test_packed.root", vectors);
+  CheckTree("SparseVectorStreamer_test_standard.root", vectors);
+
+} // SparseVectorStreamerTest()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SparseVectorStreamerTestCase)
+{
+  SparseVectorStreamerTest();
+}
@@ -0,0 +1,143 @@
+/**
+ * @file    WireBlock_test.cc
+ * @brief   Tests the conversion and access of a `recob::WireBlock` object.
+ * @see     lardataobj/RecoBase/WireBlock.h
+ */
+
+// C/C++ standard library
+#include <algorithm> // std::equal()
+#include <stdexcept> // std::out_of_range
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE (wireblock_test)
+#include "boost/test/unit_test.hpp"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"  // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h" // geo::View_t
+#include "lardataobj/RecoBase/Wire.h"
+#include "lardataobj/RecoBase/WireBlock.h"
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+std::vector<recob::Wire> MakeTestWires()
+{
+  using ROI_t = recob::Wire::RegionsOfInterest_t;
+
+  std::vector<recob::Wire> wires;
+
+  // channel with two regions of interest, one at the very start
+  ROI_t sigROIlist(20);
+  sigROIlist.add_range(0, ROI_t::vector_t({1., 2.}));
+  sigROIlist.add_range(11, ROI_t::vector_t({11., 12., 13., 14.}));
+  wires.emplace_back(sigROIlist, 12, geo::kV);
+
+  // channel with no signal at all
+  wires.emplace_back(ROI_t(20), 13, geo::kV);
+
+  // empty channel
+  wires.emplace_back(ROI_t(), 14, geo::kW);
+
+  // channel with a region of interest at the very end
+  ROI_t lastROI(10);
+  lastROI.add_range(7, ROI_t::vector_t({7., 8., 9.}));
+  wires.emplace_back(lastROI, 2, geo::kU);
+
+  return wires;
+} // MakeTestWires()
+
+void CheckChannel(recob::WireBlock::ChannelView const& channel, recob::Wire const& wire)
+{
+  auto const& ROIs = wire.SignalROI();
+
+  BOOST_TEST(channel.Channel() == wire.Channel());
+  BOOST_TEST(channel.View() == wire.View());
+  BOOST_TEST(channel.NSignal() == wire.NSignal());
+  BOOST_TEST(channel.size() == ROIs.size());
+  BOOST_TEST(channel.n_ranges() == ROIs.n_ranges());
+  BOOST_TEST(channel.count() == ROIs.count());
+
+  std::size_t iRange = 0;
+  for (auto const& range : channel.get_ranges()) {
+    auto const& expected = ROIs.range(iRange++);
+    BOOST_TEST(range.begin_index() == expected.begin_index());
+    BOOST_TEST(range.end_index() == expected.end_index());
+    BOOST_TEST(std::equal(range.begin(), range.end(), expected.begin(), expected.end()));
+  }
+  BOOST_TEST(iRange == ROIs.n_ranges());
+
+  for (std::size_t tick = 0; tick < channel.size(); ++tick) {
+    BOOST_TEST(channel[tick] == ROIs[tick]);
+    // (`lar::sparse_vector::is_void()` throws on vectors with no ranges)
+    BOOST_TEST(channel.is_void(tick) == (ROIs.get_ranges().empty() || ROIs.is_void(tick)));
+  }
+  BOOST_CHECK_THROW(channel.is_void(channel.size()), std::out_of_range);
+
+  auto const signal = wire.Signal();
+  BOOST_TEST(channel.Signal() == signal, boost::test_tools::per_element());
+
+  std::size_t const firstTick = channel.NSignal() / 3;
+  std::vector<float> partial(channel.NSignal() - firstTick, -1.0F);
+  channel.FillSignal(partial, firstTick);
+  BOOST_TEST(std::equal(partial.begin(), partial.end(), signal.begin() + firstTick));
+
+  recob::Wire const copy = channel.MakeWire();
+  BOOST_TEST(copy.Channel() == wire.Channel());
+  BOOST_TEST(copy.SignalROI().n_ranges() == ROIs.n_ranges());
+  BOOST_TEST(copy.Signal() == signal, boost::test_tools::per_element());
+
+} // CheckChannel()
+
+void WireBlockTestConversion()
+{
+  std::vector<recob::Wire> const wires = MakeTestWires();
+
+  recob::WireBlock const block(wires);
+
+  BOOST_TEST(block.NChannels() == wires.size());
+  BOOST_TEST(!block.empty());
+  BOOST_TEST(block.NRanges() == 3U);
+  BOOST_TEST(block.NSamples() == 9U);
+  BOOST_TEST(block.Samples().front() == 1.0F);
+  BOOST_TEST(block.Samples().back() == 9.0F);
+
+  for (std::size_t i = 0; i < wires.size(); ++i) {
+    BOOST_TEST(block.ChannelIDs()[i] == wires[i].Channel());
+    BOOST_TEST(block.Views()[i] == wires[i].View());
+    CheckChannel(block[i], wires[i]);
+  }
+  BOOST_CHECK_THROW(block.at(wires.size()), std::out_of_range);
+
+  std::vector<recob::Wire> const back = block.ToWires();
+  BOOST_TEST(back.size() == wires.size());
+  for (std::size_t i = 0; i < back.size(); ++i)
+    CheckChannel(block[i], back[i]);
+
+} // WireBlockTestConversion()
+
+void WireBlockTestDefaultConstructor()
+{
+  recob::WireBlock const block;
+  BOOST_TEST(block.empty());
+  BOOST_TEST(block.NChannels() == 0U);
+  BOOST_TEST(block.NRanges() == 0U);
+  BOOST_TEST(block.NSamples() == 0U);
+  BOOST_TEST(block.ToWires().empty());
+} // WireBlockTestDefaultConstructor()
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(WireBlockDefaultConstructor)
+{
+  WireBlockTestDefaultConstructor();
+}
+
+BOOST_AUTO_TEST_CASE(WireBlockConversion)
+{
+  WireBlockTestConversion();
+}
@@ -0,0 +1,188 @@
+/**
+ * @file    WireROIIndex_test.cc
+ * @brief   Tests the queries of a `recob::WireROIIndex` object.
+ * @see     lardataobj/RecoBase/WireROIIndex.h
+ */
+
+// C/C++ standard library
+#include <algorithm> // std::sort()
+#include <tuple>     // std::tie(), std::make_tuple()
+#include <utility>   // std::move(), std::pair
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE (wireroiindex_test)
+#include "boost/test/unit_test.hpp"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"  // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h" // geo::View_t
+#include "lardataobj/RecoBase/Wire.h"
+#include "lardataobj/RecoBase/WireROIIndex.h"
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+using ROI_t = recob::WireROIIndex::ROI_t;
+
+/// Creates wires on two views, not sorted by channel, with varied regions.
+std::vector<recob::Wire> MakeTestWires()
+{
+  using Signal_t = recob::Wire::RegionsOfInterest_t;
+
+  std::vector<recob::Wire> wires;
+  for (raw::ChannelID_t channel : {7U, 2U, 5U, 0U, 12U, 10U, 11U, 3U}) {
+    geo::View_t const view = (channel < 8) ? geo::kU : geo::kV;
+    Signal_t signal(100);
+    // a pattern of regions depending on the channel
+    for (std::size_t start = channel % 4; start + 3 < signal.size(); start += 9 + channel % 5) {
+      std::size_t const length = 1 + (start + channel) % 6;
+      signal.add_range(start, Signal_t::vector_t(length, float(channel)));
+    }
+    wires.emplace_back(std::move(signal), channel, view);
+  } // for channels
+  wires.emplace_back(Signal_t(100), 4U, geo::kU); // no regions
+  return wires;
+} // MakeTestWires()
+
+/// Returns the regions overlapping the window, by brute force.
+std::vector<ROI_t> BruteForce(std::vector<recob::Wire> const& wires,
+                              geo::View_t view,
+                              raw::ChannelID_t c0,
+                              raw::ChannelID_t c1,
+                              std::size_t t0,
+                              std::size_t t1)
+{
+  std::vector<ROI_t> ROIs;
+  for (std::size_t iWire = 0; iWire < wires.size(); ++iWire) {
+    recob::Wire const& wire = wires[iWire];
+    if ((view != geo::kUnknown) && (wire.View() != view)) continue;
+    if ((wire.Channel() < c0) || (wire.Channel() >= c1)) continue;
+    std::size_t iRange = 0;
+    for (auto const& range : wire.SignalROI().get_ranges()) {
+      if ((range.begin_index() < t1) && (range.end_index() > t0) && (t0 < t1))
+        ROIs.push_back({wire.Channel(), iWire, iRange, range.begin_index(), range.end_index()});
+      ++iRange;
+    }
+  }
+  return ROIs;
+} // BruteForce()
+
+void CheckSame(std::vector<ROI_t> result, std::vector<ROI_t> expected)
+{
+  auto const byPosition = [](ROI_t const& a, ROI_t const& b) {
+    return std::tie(a.wire, a.range) < std::tie(b.wire, b.range);
+  };
+  std::sort(result.begin(), result.end(), byPosition);
+  std::sort(expected.begin(), expected.end(), byPosition);
+  BOOST_TEST_REQUIRE(result.size() == expected.size());
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    BOOST_TEST(result[i].channel == expected[i].channel);
+    BOOST_TEST(result[i].wire == expected[i].wire);
+    BOOST_TEST(result[i].range == expected[i].range);
+    BOOST_TEST(result[i].begin == expected[i].begin);
+    BOOST_TEST(result[i].end == expected[i].end);
+  }
+} // CheckSame()
+
+/// Checks that the regions are sorted by view, channel and tick.
+void CheckOrder(std::vector<ROI_t> const& ROIs, std::vector<recob::Wire> const& wires)
+{
+  for (std::size_t i = 1; i < ROIs.size(); ++i) {
+    ROI_t const& prev = ROIs[i - 1];
+    ROI_t const& roi = ROIs[i];
+    BOOST_TEST((std::make_tuple(wires[prev.wire].View(), prev.channel, prev.begin) <
+                std::make_tuple(wires[roi.wire].View(), roi.channel, roi.begin)));
+  }
+} // CheckOrder()
+
+void WireROIIndexTestQueries()
+{
+  std::vector<recob::Wire> const wires = MakeTestWires();
+  recob::WireROIIndex const index{wires};
+
+  std::size_t nROIs = 0;
+  for (recob::Wire const& wire : wires)
+    nROIs += wire.SignalROI().n_ranges();
+  BOOST_TEST(index.size() == nROIs);
+
+  for (std::size_t t0 = 0; t0 < 100; t0 += 7) {
+    for (std::size_t t1 : {t0, t0 + 1, t0 + 5, t0 + 30, std::size_t(200)}) {
+      for (raw::ChannelID_t c0 : {0U, 3U, 6U, 11U}) {
+        for (raw::ChannelID_t c1 : {c0, c0 + 1, c0 + 4, 20U}) {
+          auto const ROIs = index.Overlapping(c0, c1, t0, t1);
+          CheckOrder(ROIs, wires);
+          CheckSame(ROIs, BruteForce(wires, geo::kUnknown, c0, c1, t0, t1));
+        }
+      }
+      for (geo::View_t view : {geo::kU, geo::kV, geo::kW}) {
+        auto const ROIs = index.Overlapping(view, t0, t1);
+        CheckOrder(ROIs, wires);
+        CheckSame(ROIs, BruteForce(wires, view, 0, 100, t0, t1));
+      }
+    }
+  }
+
+} // WireROIIndexTestQueries()
+
+void WireROIIndexTestManyChannels()
+{
+  using Signal_t = recob::Wire::RegionsOfInterest_t;
+
+  // many channels with regions early and late, and only a few in between
+  std::vector<recob::Wire> wires;
+  for (raw::ChannelID_t channel = 0; channel < 500; ++channel) {
+    Signal_t signal(1000);
+    signal.add_range(10 + channel % 7, Signal_t::vector_t(5, 1.0f));
+    if (channel % 50 == 0) signal.add_range(500 + channel % 3, Signal_t::vector_t(8, 2.0f));
+    signal.add_range(900 - channel % 11, Signal_t::vector_t(20, 3.0f));
+    wires.emplace_back(std::move(signal), channel, geo::kW);
+  }
+  recob::WireROIIndex const index{wires};
+
+  for (auto const& [t0, t1] : {std::pair<std::size_t, std::size_t>{495, 510},
+                              {0, 1000},
+                              {12, 13},
+                              {300, 400},
+                              {905, 906}}) {
+    BOOST_TEST_CONTEXT("ticks [" << t0 << "; " << t1 << ")")
+    {
+      auto const ROIs = index.Overlapping(geo::kW, t0, t1);
+      CheckOrder(ROIs, wires);
+      CheckSame(ROIs, BruteForce(wires, geo::kW, 0, 500, t0, t1));
+      for (raw::ChannelID_t c0 : {0U, 49U, 120U}) {
+        auto const rangeROIs = index.Overlapping(c0, c0 + 80, t0, t1);
+        CheckOrder(rangeROIs, wires);
+        CheckSame(rangeROIs, BruteForce(wires, geo::kUnknown, c0, c0 + 80, t0, t1));
+      }
+    }
+  }
+} // WireROIIndexTestManyChannels()
+
+void WireROIIndexTestDefaultConstructor()
+{
+  recob::WireROIIndex const index;
+  BOOST_TEST(index.empty());
+  BOOST_TEST(index.Overlapping(0, 100, 0, 100).empty());
+  BOOST_TEST(index.Overlapping(geo::kU, 0, 100).empty());
+} // WireROIIndexTestDefaultConstructor()
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(WireROIIndexDefaultConstructor)
+{
+  WireROIIndexTestDefaultConstructor();
+}
+
+BOOST_AUTO_TEST_CASE(WireROIIndexQueries)
+{
+  WireROIIndexTestQueries();
+}
+
+BOOST_AUTO_TEST_CASE(WireROIIndexManyChannels)
+{
+  WireROIIndexTestManyChannels();
+}
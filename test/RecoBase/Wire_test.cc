@@ -16,6 +16,8 @@
 
 // C/C++ standard library
 #include <algorithm> // std::equal()
+#include <stdexcept> // std::length_error, std::out_of_range
+#include <vector>
 
 // Boost libraries
 /*
@@ -68,6 +70,28 @@ void CheckWire(recob::Wire const& wire,
   auto const& wire_signal = wire.Signal();
   BOOST_TEST(std::equal(wire_signal.begin(), wire_signal.end(), sigROIlist.cbegin()));
 
+  // - dense export into a (dirty) buffer, larger than needed
+  std::vector<float> buffer(wire.NSignal() + 2, -1.0F);
+  wire.FillSignal(buffer);
+  BOOST_TEST(std::equal(wire_signal.begin(), wire_signal.end(), buffer.begin()));
+  BOOST_TEST(buffer.back() == -1.0F);
+
+  if (wire.NSignal() > 0) {
+    std::vector<float> small(wire.NSignal() - 1);
+    BOOST_CHECK_THROW(wire.FillSignal(small), std::length_error);
+  }
+
+  // - dense export of each range of ticks starting from the middle
+  std::size_t const firstTick = wire.NSignal() / 2;
+  std::size_t const nTicks = wire.NSignal() - firstTick;
+  for (std::size_t n = 0; n <= nTicks; ++n) {
+    std::vector<float> partial(n, -1.0F);
+    wire.FillSignal(partial, firstTick);
+    BOOST_TEST(std::equal(partial.begin(), partial.end(), wire_signal.begin() + firstTick));
+  }
+  std::vector<float> tooLong(nTicks + 1);
+  BOOST_CHECK_THROW(wire.FillSignal(tooLong, firstTick), std::out_of_range);
+
 } // CheckWire()
 
 void WireTestDefaultConstructor()
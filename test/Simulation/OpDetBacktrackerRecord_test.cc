@@ -0,0 +1,378 @@
+/**
+ * @file    OpDetBacktrackerRecord_test.cc
+ * @brief   Tests the filling and the queries of `sim::OpDetBacktrackerRecord`.
+ * @see     lardataobj/Simulation/OpDetBacktrackerRecord.h
+ * @see     lardataobj/Simulation/OpDetBacktrackerRecordBuilder.h
+ * @see     lardataobj/Simulation/OpDetBacktrackerRecordTimeIndex.h
+ */
+
+// C/C++ standard library
+#include <array>
+#include <cstddef>   // std::size_t
+#include <limits>
+#include <map>
+#include <stdexcept> // std::invalid_argument, std::runtime_error
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE (opdetbacktrackerrecord_test)
+#include "boost/test/unit_test.hpp"
+
+// LArSoft libraries
+#include "lardataobj/Simulation/OpDetBacktrackerRecord.h"
+#include "lardataobj/Simulation/OpDetBacktrackerRecordBuilder.h"
+#include "lardataobj/Simulation/OpDetBacktrackerRecordTimeIndex.h"
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+/// Photons as passed to `sim::OpDetBacktrackerRecord::AddScintillationPhotons()`.
+struct TestPhotons {
+  int trackID;
+  double time;
+  double numPhotons;
+  std::array<double, 3U> xyz;
+  double energy;
+};
+
+/// Creates photons with unsorted times, repeated tracks and a few invalid ones.
+std::vector<TestPhotons> MakeTestPhotons()
+{
+  std::vector<TestPhotons> photons;
+  for (unsigned int i = 0; i < 2000; ++i) {
+    photons.push_back({int((i * 37) % 11) - 2,                      // trackID
+                       ((i * 7919) % 1201) * 0.35 - 20.0,           // time
+                       (i % 97 == 0) ? 0.0 : 1.0 + (i % 13),        // numPhotons
+                       {i * 0.1, -1.0 + i * 0.03, 500.0 / (i + 1)}, // xyz
+                       0.001 * ((i % 17) + 1)});                    // energy
+  }
+  return photons;
+} // MakeTestPhotons()
+
+/// Fills a record with all the specified photons.
+sim::OpDetBacktrackerRecord MakeTestRecord(std::vector<TestPhotons> const& photons)
+{
+  sim::OpDetBacktrackerRecord record{5};
+  for (TestPhotons const& p : photons)
+    record.AddScintillationPhotons(p.trackID, p.time, p.numPhotons, p.xyz.data(), p.energy);
+  return record;
+} // MakeTestRecord()
+
+/// Checks that two lists of deposits are exactly the same.
+void CheckSameSDPs(std::vector<sim::SDP> const& sdps, std::vector<sim::SDP> const& expected)
+{
+  BOOST_TEST_REQUIRE(sdps.size() == expected.size());
+  for (std::size_t i = 0; i < sdps.size(); ++i) {
+    BOOST_TEST(sdps[i].trackID == expected[i].trackID);
+    BOOST_TEST(sdps[i].numPhotons == expected[i].numPhotons);
+    BOOST_TEST(sdps[i].energy == expected[i].energy);
+    BOOST_TEST(sdps[i].x == expected[i].x);
+    BOOST_TEST(sdps[i].y == expected[i].y);
+    BOOST_TEST(sdps[i].z == expected[i].z);
+  }
+} // CheckSameSDPs()
+
+/// Checks that two lists of track photons are exactly the same.
+void CheckSameTrackSDPs(std::vector<sim::TrackSDP> const& trackSDPs,
+                        std::vector<sim::TrackSDP> const& expected)
+{
+  BOOST_TEST_REQUIRE(trackSDPs.size() == expected.size());
+  for (std::size_t i = 0; i < trackSDPs.size(); ++i) {
+    BOOST_TEST(trackSDPs[i].trackID == expected[i].trackID);
+    BOOST_TEST(trackSDPs[i].energyFrac == expected[i].energyFrac);
+    BOOST_TEST(trackSDPs[i].energy == expected[i].energy);
+  }
+} // CheckSameTrackSDPs()
+
+/// Checks that two records have exactly the same content.
+void CheckSameRecord(sim::OpDetBacktrackerRecord const& record,
+                     sim::OpDetBacktrackerRecord const& expected)
+{
+  BOOST_TEST(record.OpDetNum() == expected.OpDetNum());
+  auto const& timeSDPs = record.timePDclockSDPsMap();
+  auto const& expectedTimeSDPs = expected.timePDclockSDPsMap();
+  BOOST_TEST_REQUIRE(timeSDPs.size() == expectedTimeSDPs.size());
+  for (std::size_t i = 0; i < timeSDPs.size(); ++i) {
+    BOOST_TEST_CONTEXT("entry #" << i)
+    {
+      BOOST_TEST(timeSDPs[i].first == expectedTimeSDPs[i].first);
+      CheckSameSDPs(timeSDPs[i].second, expectedTimeSDPs[i].second);
+    }
+  } // for
+} // CheckSameRecord()
+
+//------------------------------------------------------------------------------
+/// Aggregates the deposits in the window by track, with a `std::map`.
+std::vector<sim::SDP> ReferenceTrackIDsAndEnergies(sim::OpDetBacktrackerRecord const& record,
+                                                   double startTime,
+                                                   double endTime)
+{
+  std::map<int, sim::SDP> idToSDP;
+  for (auto const& [time, sdps] : record.timePDclockSDPsMap()) {
+    if ((time < startTime) || (time > endTime)) continue;
+    for (sim::SDP const& sdp : sdps) {
+      auto const itTrkSDP = idToSDP.find(sdp.trackID);
+      if (itTrkSDP == idToSDP.end()) {
+        idToSDP.emplace(sdp.trackID, sdp);
+        continue;
+      }
+      sim::SDP& trackSDP = itTrkSDP->second;
+      double const nPh1 = trackSDP.numPhotons;
+      double const nPh2 = sdp.numPhotons;
+      double const weight = nPh1 + nPh2;
+      trackSDP.x = (sdp.x * nPh2 + trackSDP.x * nPh1) / weight;
+      trackSDP.y = (sdp.y * nPh2 + trackSDP.y * nPh1) / weight;
+      trackSDP.z = (sdp.z * nPh2 + trackSDP.z * nPh1) / weight;
+      trackSDP.numPhotons = weight;
+    } // for SDPs
+  }   // for times
+  std::vector<sim::SDP> result;
+  for (auto const& trackSDP : idToSDP)
+    result.push_back(trackSDP.second);
+  return result;
+} // ReferenceTrackIDsAndEnergies()
+
+void OpDetBacktrackerRecordTrackSDPsTest()
+{
+  sim::OpDetBacktrackerRecord const record = MakeTestRecord(MakeTestPhotons());
+
+  std::vector<sim::SDP> sdps;           // reused for all the windows
+  std::vector<sim::TrackSDP> trackSDPs; // reused for all the windows
+  for (double start = -30.0; start < 430.0; start += 7.0) {
+    for (double const length : {0.0, 1.0, 5.0, 30.0, 500.0}) {
+      BOOST_TEST_CONTEXT("time window [ " << start << " ; " << (start + length) << " ]")
+      {
+        auto const expected = ReferenceTrackIDsAndEnergies(record, start, start + length);
+        CheckSameSDPs(record.TrackIDsAndEnergies(start, start + length), expected);
+        record.TrackIDsAndEnergies(start, start + length, sdps);
+        CheckSameSDPs(sdps, expected);
+
+        double totalPhotons = 0.0;
+        for (sim::SDP const& sdp : expected)
+          totalPhotons += sdp.numPhotons;
+        if (totalPhotons < 1.e-5) totalPhotons = 1.;
+        std::vector<sim::TrackSDP> expectedTrackSDPs;
+        for (sim::SDP const& sdp : expected) {
+          expectedTrackSDPs.emplace_back(
+            sdp.trackID, sdp.numPhotons / totalPhotons, sdp.numPhotons);
+        }
+        CheckSameTrackSDPs(record.TrackSDPs(start, start + length), expectedTrackSDPs);
+        record.TrackSDPs(start, start + length, trackSDPs, sdps);
+        CheckSameTrackSDPs(trackSDPs, expectedTrackSDPs);
+        CheckSameSDPs(sdps, expected);
+      }
+    }
+  } // for start
+
+  // a bogus interval clears the buffers
+  record.TrackSDPs(10.0, 5.0, trackSDPs, sdps);
+  BOOST_TEST(trackSDPs.empty());
+  BOOST_TEST(sdps.empty());
+
+} // OpDetBacktrackerRecordTrackSDPsTest()
+
+//------------------------------------------------------------------------------
+void OpDetBacktrackerRecordAddPhotonsTest()
+{
+  double const xyz[3] = {1.0, 2.0, 3.0};
+
+  // the distance from an existing time entry is truncated to an integer:
+  // photons up to 1 ns before the entry are added to it
+  sim::OpDetBacktrackerRecord record{5};
+  record.AddScintillationPhotons(1, 11.0, 2.0, xyz, 0.01);
+  record.AddScintillationPhotons(1, 10.7, 2.0, xyz, 0.01); // 0.3 ns: added to 11
+  record.AddScintillationPhotons(1, 10.3, 2.0, xyz, 0.01); // 0.7 ns: added to 11
+  record.AddScintillationPhotons(2, 9.5, 2.0, xyz, 0.01);  // 1.5 ns: new entry at 10
+  record.AddScintillationPhotons(2, 10.0, 2.0, xyz, 0.01); // same time: added to 10
+
+  auto const& timeSDPs = record.timePDclockSDPsMap();
+  BOOST_TEST_REQUIRE(timeSDPs.size() == 2U);
+  BOOST_TEST(timeSDPs[0].first == 10.0);
+  BOOST_TEST_REQUIRE(timeSDPs[0].second.size() == 1U);
+  BOOST_TEST(timeSDPs[0].second[0].trackID == 2);
+  BOOST_TEST(timeSDPs[0].second[0].numPhotons == 4.0);
+  BOOST_TEST(timeSDPs[1].first == 11.0);
+  BOOST_TEST_REQUIRE(timeSDPs[1].second.size() == 1U);
+  BOOST_TEST(timeSDPs[1].second[0].trackID == 1);
+  BOOST_TEST(timeSDPs[1].second[0].numPhotons == 6.0);
+
+} // OpDetBacktrackerRecordAddPhotonsTest()
+
+//------------------------------------------------------------------------------
+void OpDetBacktrackerRecordBuilderTest()
+{
+  std::vector<TestPhotons> photons = MakeTestPhotons();
+
+  // a few times matching an existing entry or not, also negative
+  for (double const time :
+       {11.0, 10.3, 10.5, 10.7, 11.0, 12.0, -0.5, -0.3, -0.7, -1.5, -1.0, 0.0}) {
+    for (int const track : {1, 2, 1})
+      photons.push_back({track, time, 2.5, {1.0, 2.0, 3.0}, 0.01});
+  }
+
+  sim::OpDetBacktrackerRecord const expected = MakeTestRecord(photons);
+
+  sim::OpDetBacktrackerRecordBuilder builder{5};
+  BOOST_TEST(builder.OpDetNum() == 5);
+  BOOST_TEST(builder.empty());
+  for (TestPhotons const& p : photons)
+    builder.AddScintillationPhotons(p.trackID, p.time, p.numPhotons, p.xyz.data(), p.energy);
+  BOOST_TEST(builder.size() < photons.size()); // some were rejected
+
+  CheckSameRecord(builder.Build(), expected);
+  for (unsigned int const nThreads : {1U, 2U, 4U}) {
+    BOOST_TEST_CONTEXT("threads: " << nThreads)
+    {
+      CheckSameRecord(builder.Build(nThreads), expected);
+    }
+  }
+
+  // the same, filled in two parts
+  std::size_t const half = photons.size() / 2;
+  sim::OpDetBacktrackerRecordBuilder first{5}, second{5};
+  for (std::size_t i = 0; i < photons.size(); ++i) {
+    TestPhotons const& p = photons[i];
+    (i < half ? first : second)
+      .AddScintillationPhotons(p.trackID, p.time, p.numPhotons, p.xyz.data(), p.energy);
+  }
+  first.Append(second);
+  BOOST_TEST(first.size() == builder.size());
+  CheckSameRecord(first.Build(), expected);
+
+  BOOST_CHECK_THROW(first.Append(sim::OpDetBacktrackerRecordBuilder{6}), std::runtime_error);
+
+  builder.Clear();
+  BOOST_TEST(builder.empty());
+  sim::OpDetBacktrackerRecord const empty = builder.Build();
+  BOOST_TEST(empty.OpDetNum() == 5);
+  BOOST_TEST(empty.timePDclockSDPsMap().empty());
+
+} // OpDetBacktrackerRecordBuilderTest()
+
+//------------------------------------------------------------------------------
+void OpDetBacktrackerRecordTimeIndexTest()
+{
+  sim::OpDetBacktrackerRecord const record = MakeTestRecord(MakeTestPhotons());
+  auto const& timeSDPs = record.timePDclockSDPsMap();
+  BOOST_TEST_REQUIRE(timeSDPs.size() > 100U);
+
+  BOOST_CHECK_THROW((sim::OpDetBacktrackerRecordTimeIndex{record, 0.0}), std::invalid_argument);
+
+  for (double const binWidth : {0.3, 1.0, 7.5, 1000.0}) {
+    BOOST_TEST_CONTEXT("bin width: " << binWidth)
+    {
+      sim::OpDetBacktrackerRecordTimeIndex const index{record, binWidth};
+      BOOST_TEST(index.BinWidth() >= binWidth);
+      BOOST_TEST(index.NBins() > 0U);
+      BOOST_TEST(index.NBins() <= sim::OpDetBacktrackerRecordTimeIndex::MaxBinsPerEntry *
+                                    timeSDPs.size());
+
+      for (double time = -30.0; time < 430.0; time += 0.25) {
+        std::size_t expected = 0;
+        while ((expected < timeSDPs.size()) && (timeSDPs[expected].first < time))
+          ++expected;
+        BOOST_TEST(index.FirstEntryNotBefore(time) == expected);
+        while ((expected < timeSDPs.size()) && (timeSDPs[expected].first <= time))
+          ++expected;
+        BOOST_TEST(index.FirstEntryAfter(time) == expected);
+
+        BOOST_TEST(index.Photons(time) == record.Photons(time));
+        BOOST_TEST(index.Energy(time) == record.Energy(time));
+      } // for time
+
+      std::vector<sim::SDP> sdps;           // reused for all the windows
+      std::vector<sim::TrackSDP> trackSDPs; // reused for all the windows
+      for (double start = -30.0; start < 430.0; start += 13.0) {
+        for (double const length : {0.0, 2.0, 25.0, 500.0}) {
+          double const end = start + length;
+
+          double photons = 0.0, energy = 0.0;
+          for (auto const& [time, timeSDPList] : timeSDPs) {
+            if ((time < start) || (time > end)) continue;
+            for (auto const& sdp : timeSDPList) {
+              photons += sdp.numPhotons;
+              energy += sdp.energy;
+            }
+          }
+          BOOST_TEST(index.PhotonsInRange(start, end) == photons,
+                     1e-6 % boost::test_tools::tolerance());
+          BOOST_TEST(index.EnergyInRange(start, end) == energy,
+                     1e-6 % boost::test_tools::tolerance());
+
+          auto const expectedSDPs = record.TrackIDsAndEnergies(start, end);
+          CheckSameSDPs(index.TrackIDsAndEnergies(start, end), expectedSDPs);
+          index.TrackIDsAndEnergies(start, end, sdps);
+          CheckSameSDPs(sdps, expectedSDPs);
+
+          auto const expectedTrackSDPs = record.TrackSDPs(start, end);
+          CheckSameTrackSDPs(index.TrackSDPs(start, end), expectedTrackSDPs);
+          index.TrackSDPs(start, end, trackSDPs, sdps);
+          CheckSameTrackSDPs(trackSDPs, expectedTrackSDPs);
+          CheckSameSDPs(sdps, expectedSDPs);
+        } // for length
+      }   // for start
+
+      BOOST_TEST(index.TrackSDPs(10.0, 5.0).empty());
+
+      // undefined times match no entry
+      double const nan = std::numeric_limits<double>::quiet_NaN();
+      BOOST_TEST(index.FirstEntryNotBefore(nan) == timeSDPs.size());
+      BOOST_TEST(index.FirstEntryAfter(nan) == timeSDPs.size());
+      BOOST_TEST(index.Photons(nan) == 0.0);
+      BOOST_TEST(index.PhotonsInRange(nan, 100.0) == 0.0);
+      BOOST_TEST(index.EnergyInRange(0.0, nan) == 0.0);
+      BOOST_TEST(index.TrackIDsAndEnergies(0.0, nan).empty());
+      BOOST_TEST(index.TrackSDPs(nan, nan).empty());
+    }
+  } // for bin width
+
+  // an empty record
+  sim::OpDetBacktrackerRecord const empty{3};
+  sim::OpDetBacktrackerRecordTimeIndex const emptyIndex{empty, 1.0};
+  BOOST_TEST(emptyIndex.NBins() == 0U);
+  BOOST_TEST(emptyIndex.FirstEntryNotBefore(5.0) == 0U);
+  BOOST_TEST(emptyIndex.PhotonsInRange(0.0, 10.0) == 0.0);
+  BOOST_TEST(emptyIndex.TrackSDPs(0.0, 10.0).empty());
+
+  // a far away entry and a tiny bin width: the bins are widened
+  double const xyz[3] = {1.0, 2.0, 3.0};
+  sim::OpDetBacktrackerRecord farRecord{4};
+  farRecord.AddScintillationPhotons(1, 10.0, 2.0, xyz, 0.01);
+  farRecord.AddScintillationPhotons(1, 12.0, 3.0, xyz, 0.01);
+  farRecord.AddScintillationPhotons(2, 1e15, 4.0, xyz, 0.01);
+  sim::OpDetBacktrackerRecordTimeIndex const farIndex{farRecord, 1e-6};
+  BOOST_TEST(farIndex.NBins() <= 3U * sim::OpDetBacktrackerRecordTimeIndex::MaxBinsPerEntry);
+  BOOST_TEST(farIndex.BinWidth() > 1e-6);
+  BOOST_TEST(farIndex.FirstEntryNotBefore(11.0) == 1U);
+  BOOST_TEST(farIndex.FirstEntryAfter(12.0) == 2U);
+  BOOST_TEST(farIndex.FirstEntryNotBefore(1e15) == 2U);
+  BOOST_TEST(farIndex.FirstEntryAfter(1e15) == 3U);
+  BOOST_TEST(farIndex.PhotonsInRange(0.0, 20.0) == 5.0);
+  BOOST_TEST(farIndex.Photons(1e15) == 4.0);
+
+} // OpDetBacktrackerRecordTimeIndexTest()
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(OpDetBacktrackerRecordAddPhotonsTestCase)
+{
+  OpDetBacktrackerRecordAddPhotonsTest();
+}
+
+BOOST_AUTO_TEST_CASE(OpDetBacktrackerRecordTrackSDPsTestCase)
+{
+  OpDetBacktrackerRecordTrackSDPsTest();
+}
+
+BOOST_AUTO_TEST_CASE(OpDetBacktrackerRecordBuilderTestCase)
+{
+  OpDetBacktrackerRecordBuilderTest();
+}
+
+BOOST_AUTO_TEST_CASE(OpDetBacktrackerRecordTimeIndexTestCase)
+{
+  OpDetBacktrackerRecordTimeIndexTest();
+}
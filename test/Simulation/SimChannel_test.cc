@@ -0,0 +1,609 @@
+/**
+ * @file    SimChannel_test.cc
+ * @brief   Tests the filling and the queries of `sim::SimChannel`.
+ * @see     lardataobj/Simulation/SimChannel.h
+ * @see     lardataobj/Simulation/CompactSimChannel.h
+ * @see     lardataobj/Simulation/SimChannelOverlay.h
+ * @see     lardataobj/Simulation/SimChannelRangeSums.h
+ * @see     lardataobj/Simulation/SimChannelTrackIndex.h
+ */
+
+// C/C++ standard library
+#include <algorithm> // std::min(), std::max()
+#include <array>
+#include <cstdlib>   // std::abs()
+#include <limits>
+#include <map>
+#include <span>
+#include <stdexcept> // std::runtime_error
+#include <utility>   // std::pair
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE (simchannel_test)
+#include "boost/test/unit_test.hpp"
+
+// LArSoft libraries
+#include "lardataobj/Simulation/CompactSimChannel.h"
+#include "lardataobj/Simulation/SimChannel.h"
+#include "lardataobj/Simulation/SimChannelBuilder.h"
+#include "lardataobj/Simulation/SimChannelOverlay.h"
+#include "lardataobj/Simulation/SimChannelRangeSums.h"
+#include "lardataobj/Simulation/SimChannelTrackIndex.h"
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+/// A deposit as passed to `sim::SimChannel::AddIonizationElectrons()`.
+struct TestDeposit {
+  sim::SimChannel::TrackID_t trackID;
+  sim::SimChannel::TDC_t tdc;
+  double numElectrons;
+  std::array<double, 3U> xyz;
+  double energy;
+  sim::SimChannel::TrackID_t origTrackID;
+};
+
+/// Creates deposits with unsorted TDC, repeated tracks and a few invalid ones.
+std::vector<TestDeposit> MakeTestDeposits()
+{
+  std::vector<TestDeposit> deposits;
+  for (unsigned int i = 0; i < 2000; ++i) {
+    int const track = int((i * 37) % 11) - 2;
+    deposits.push_back({track,                                       // trackID
+                        (i * 7919) % 211,                            // tdc
+                        (i % 97 == 0) ? 0.0 : 10.0 + (i % 13) * 3.7, // numElectrons
+                        {i * 0.1, -1.0 + i * 0.03, 500.0 / (i + 1)}, // xyz
+                        0.001 * ((i % 17) + 1),                      // energy
+                        (track < 0) ? track : track % 7});           // origTrackID
+  }
+  return deposits;
+} // MakeTestDeposits()
+
+void CheckSameSimChannel(sim::SimChannel const& test, sim::SimChannel const& expected)
+{
+  BOOST_TEST(test.Channel() == expected.Channel());
+  auto const& testTDCs = test.TDCIDEMap();
+  auto const& expectedTDCs = expected.TDCIDEMap();
+  BOOST_TEST_REQUIRE(testTDCs.size() == expectedTDCs.size());
+  for (std::size_t iTDC = 0; iTDC < testTDCs.size(); ++iTDC) {
+    BOOST_TEST_CONTEXT("TDC entry #" << iTDC)
+    {
+      BOOST_TEST(testTDCs[iTDC].first == expectedTDCs[iTDC].first);
+      auto const& testIDEs = testTDCs[iTDC].second;
+      auto const& expectedIDEs = expectedTDCs[iTDC].second;
+      BOOST_TEST_REQUIRE(testIDEs.size() == expectedIDEs.size());
+      for (std::size_t iIDE = 0; iIDE < testIDEs.size(); ++iIDE) {
+        sim::IDE const& ide = testIDEs[iIDE];
+        sim::IDE const& expectedIDE = expectedIDEs[iIDE];
+        BOOST_TEST(ide.trackID == expectedIDE.trackID);
+        BOOST_TEST(ide.origTrackID == expectedIDE.origTrackID);
+        // exact comparisons: the result must be the same
+        BOOST_TEST(ide.numElectrons == expectedIDE.numElectrons);
+        BOOST_TEST(ide.energy == expectedIDE.energy);
+        BOOST_TEST(ide.x == expectedIDE.x);
+        BOOST_TEST(ide.y == expectedIDE.y);
+        BOOST_TEST(ide.z == expectedIDE.z);
+      } // for IDE
+    }
+  } // for TDC
+} // CheckSameSimChannel()
+
+void SimChannelBuilderTest()
+{
+  raw::ChannelID_t const channel = 1234;
+  std::vector<TestDeposit> const deposits = MakeTestDeposits();
+
+  sim::SimChannel expected{channel};
+  sim::SimChannelBuilder builder{channel};
+  builder.Reserve(deposits.size());
+  for (TestDeposit const& dep : deposits) {
+    expected.AddIonizationElectrons(
+      dep.trackID, dep.tdc, dep.numElectrons, dep.xyz.data(), dep.energy, dep.origTrackID);
+    builder.AddIonizationElectrons(
+      dep.trackID, dep.tdc, dep.numElectrons, dep.xyz.data(), dep.energy, dep.origTrackID);
+  }
+  BOOST_TEST(builder.size() < deposits.size()); // some deposits were rejected
+
+  CheckSameSimChannel(builder.Build(), expected);
+
+  builder.Clear();
+  BOOST_TEST(builder.empty());
+  CheckSameSimChannel(builder.Build(), sim::SimChannel{channel});
+
+} // SimChannelBuilderTest()
+
+/// Returns a channel filled with the test deposits.
+sim::SimChannel MakeTestSimChannel(raw::ChannelID_t channel)
+{
+  sim::SimChannel simChannel{channel};
+  for (TestDeposit const& dep : MakeTestDeposits()) {
+    simChannel.AddIonizationElectrons(
+      dep.trackID, dep.tdc, dep.numElectrons, dep.xyz.data(), dep.energy, dep.origTrackID);
+  }
+  return simChannel;
+} // MakeTestSimChannel()
+
+void CheckSameIDEs(std::vector<sim::IDE> const& test, std::vector<sim::IDE> const& expected)
+{
+  BOOST_TEST_REQUIRE(test.size() == expected.size());
+  for (std::size_t i = 0; i < test.size(); ++i) {
+    BOOST_TEST(test[i].trackID == expected[i].trackID);
+    BOOST_TEST(test[i].numElectrons == expected[i].numElectrons);
+    BOOST_TEST(test[i].energy == expected[i].energy);
+    BOOST_TEST(test[i].x == expected[i].x);
+    BOOST_TEST(test[i].y == expected[i].y);
+    BOOST_TEST(test[i].z == expected[i].z);
+  }
+} // CheckSameIDEs()
+
+void CheckSameTrackIDEs(std::vector<sim::TrackIDE> const& test,
+                        std::vector<sim::TrackIDE> const& expected)
+{
+  BOOST_TEST_REQUIRE(test.size() == expected.size());
+  for (std::size_t i = 0; i < test.size(); ++i) {
+    BOOST_TEST(test[i].trackID == expected[i].trackID);
+    BOOST_TEST(test[i].energyFrac == expected[i].energyFrac);
+    BOOST_TEST(test[i].energy == expected[i].energy);
+    BOOST_TEST(test[i].numElectrons == expected[i].numElectrons);
+  }
+} // CheckSameTrackIDEs()
+
+/// Aggregates the deposits in the window by track, with a `std::map`.
+std::vector<sim::IDE> ReferenceTrackIDsAndEnergies(sim::SimChannel const& simChannel,
+                                                   sim::SimChannel::TDC_t startTDC,
+                                                   sim::SimChannel::TDC_t endTDC)
+{
+  std::map<sim::SimChannel::TrackID_t, sim::IDE> idToIDE;
+  for (auto const& [tdc, ides] : simChannel.TDCIDEMap()) {
+    if ((tdc < startTDC) || (tdc > endTDC)) continue;
+    for (sim::IDE const& ide : ides) {
+      auto const itTrkIDE = idToIDE.find(ide.trackID);
+      if (itTrkIDE == idToIDE.end()) {
+        idToIDE.emplace(ide.trackID, ide);
+        continue;
+      }
+      sim::IDE& trackIDE = itTrkIDE->second;
+      double const nel1 = trackIDE.numElectrons;
+      double const nel2 = ide.numElectrons;
+      double const weight = nel1 + nel2;
+      trackIDE.x = (ide.x * nel2 + trackIDE.x * nel1) / weight;
+      trackIDE.y = (ide.y * nel2 + trackIDE.y * nel1) / weight;
+      trackIDE.z = (ide.z * nel2 + trackIDE.z * nel1) / weight;
+      trackIDE.numElectrons = weight;
+      trackIDE.energy = double(trackIDE.energy) + double(ide.energy);
+    } // for IDEs
+  }   // for TDCs
+  std::vector<sim::IDE> result;
+  for (auto const& trackIDE : idToIDE)
+    result.push_back(trackIDE.second);
+  return result;
+} // ReferenceTrackIDsAndEnergies()
+
+void SimChannelTrackIDsAndEnergiesTest()
+{
+  sim::SimChannel const simChannel = MakeTestSimChannel(1234);
+
+  std::vector<sim::IDE> ides;           // reused for all the windows
+  std::vector<sim::TrackIDE> trackIDEs; // reused for all the windows
+  for (sim::SimChannel::TDC_t start = 0; start < 220; start += 7) {
+    for (sim::SimChannel::TDC_t const width : {0U, 1U, 5U, 30U, 300U}) {
+      BOOST_TEST_CONTEXT("TDC window [ " << start << " ; " << (start + width) << " ]")
+      {
+        auto const expected = ReferenceTrackIDsAndEnergies(simChannel, start, start + width);
+        CheckSameIDEs(simChannel.TrackIDsAndEnergies(start, start + width), expected);
+        simChannel.TrackIDsAndEnergies(start, start + width, ides);
+        CheckSameIDEs(ides, expected);
+
+        double totalE = 0.0;
+        for (sim::IDE const& ide : expected)
+          totalE += ide.energy;
+        if (totalE < 1.e-5) totalE = 1.0;
+        std::vector<sim::TrackIDE> expectedTrackIDEs;
+        for (sim::IDE const& ide : expected) {
+          expectedTrackIDEs.emplace_back(
+            ide.trackID, ide.energy / totalE, ide.energy, ide.numElectrons, ide.origTrackID);
+        }
+        CheckSameTrackIDEs(simChannel.TrackIDEs(start, start + width), expectedTrackIDEs);
+        simChannel.TrackIDEs(start, start + width, trackIDEs, ides);
+        CheckSameTrackIDEs(trackIDEs, expectedTrackIDEs);
+        CheckSameIDEs(ides, expected);
+      }
+    }
+  }
+
+  simChannel.TrackIDsAndEnergies(50, 40, ides);
+  BOOST_TEST(ides.empty());
+  simChannel.TrackIDEs(50, 40, trackIDEs, ides);
+  BOOST_TEST(trackIDEs.empty());
+  BOOST_TEST(ides.empty());
+
+} // SimChannelTrackIDsAndEnergiesTest()
+
+void SimChannelTrackIDEsBatchTest()
+{
+  sim::SimChannel const simChannel = MakeTestSimChannel(1234);
+
+  // unsorted, overlapping, empty and bogus windows
+  std::vector<sim::SimChannel::TDCWindow_t> const windows{
+    {100, 120}, {0, 10}, {105, 106}, {300, 400}, {50, 40}, {0, 300}, {7, 7}, {8, 7}, {60, 80}};
+
+  std::vector<std::vector<sim::TrackIDE>> trackIDEs{3}; // previous content is replaced
+  trackIDEs[0].emplace_back(1, 1.0, 1.0, 1.0);
+  simChannel.TrackIDEsBatch(windows, trackIDEs);
+
+  BOOST_TEST_REQUIRE(trackIDEs.size() == windows.size());
+  for (std::size_t i = 0; i < windows.size(); ++i) {
+    BOOST_TEST_CONTEXT("window #" << i)
+    {
+      CheckSameTrackIDEs(trackIDEs[i],
+                         simChannel.TrackIDEs(windows[i].startTDC, windows[i].endTDC));
+    }
+  }
+
+  simChannel.TrackIDEsBatch({}, trackIDEs);
+  BOOST_TEST(trackIDEs.empty());
+
+} // SimChannelTrackIDEsBatchTest()
+
+void SimChannelRangeSumsTest()
+{
+  sim::SimChannel const simChannel = MakeTestSimChannel(1234);
+  sim::SimChannelRangeSums const sums{simChannel};
+
+  for (sim::SimChannel::TDC_t start = 0; start < 220; start += 3) {
+    for (sim::SimChannel::TDC_t const width : {0U, 1U, 4U, 25U, 300U}) {
+      sim::SimChannel::TDC_t const end = start + width;
+      BOOST_TEST_CONTEXT("TDC range [ " << start << " ; " << end << " ]")
+      {
+        double expectedCharge = 0., expectedEnergy = 0.;
+        for (sim::SimChannel::TDC_t tdc = start; tdc <= end; ++tdc) {
+          expectedCharge += simChannel.Charge(tdc);
+          expectedEnergy += simChannel.Energy(tdc);
+        }
+        BOOST_TEST(sums.ChargeInRange(start, end) == expectedCharge,
+                   boost::test_tools::tolerance(1e-9));
+        BOOST_TEST(sums.EnergyInRange(start, end) == expectedEnergy,
+                   boost::test_tools::tolerance(1e-9));
+      }
+    }
+  }
+  BOOST_TEST(sums.ChargeInRange(50, 40) == 0.0);
+
+  sim::SimChannelRangeSums const copy{sums};
+  BOOST_TEST(&copy.Channel() == &simChannel);
+  BOOST_TEST(copy.EnergyInRange(0, 300) == sums.EnergyInRange(0, 300));
+
+  sim::SimChannel const emptyChannel{1234};
+  sim::SimChannelRangeSums const emptySums{emptyChannel};
+  BOOST_TEST(emptySums.ChargeInRange(0, 300) == 0.0);
+
+} // SimChannelRangeSumsTest()
+
+/// Returns a channel with some of the test deposits (`part` from `0` to `2`).
+sim::SimChannel MakePartialTestSimChannel(raw::ChannelID_t channel, unsigned int part)
+{
+  sim::SimChannel simChannel{channel};
+  auto const deposits = MakeTestDeposits();
+  for (std::size_t i = part; i < deposits.size(); i += 3 + part) {
+    TestDeposit const& dep = deposits[i];
+    simChannel.AddIonizationElectrons(dep.trackID,
+                                      dep.tdc + 50 * part,
+                                      dep.numElectrons,
+                                      dep.xyz.data(),
+                                      dep.energy,
+                                      dep.origTrackID);
+  }
+  return simChannel;
+} // MakePartialTestSimChannel()
+
+void CheckSameRange(std::pair<int, int> const& range, std::pair<int, int> const& expected)
+{
+  BOOST_TEST(range.first == expected.first);
+  BOOST_TEST(range.second == expected.second);
+}
+
+void SimChannelMergeTest()
+{
+  raw::ChannelID_t const channel = 1234;
+  std::array<sim::SimChannel, 3U> const parts{MakePartialTestSimChannel(channel, 0),
+                                              MakePartialTestSimChannel(channel, 1),
+                                              MakePartialTestSimChannel(channel, 2)};
+  std::array<int, 2U> const offsets{1000, 2000};
+
+  // expected: for each TDC, the deposits of each channel in order
+  std::map<sim::SimChannel::StoredTDC_t, std::vector<sim::IDE>> expectedMap;
+  std::array<std::pair<int, int>, 2U> expectedRanges{
+    {{std::numeric_limits<int>::max(), std::numeric_limits<int>::min()},
+     {std::numeric_limits<int>::max(), std::numeric_limits<int>::min()}}};
+  for (std::size_t iPart = 0; iPart < parts.size(); ++iPart) {
+    int const offset = (iPart == 0) ? 0 : offsets[iPart - 1];
+    for (auto const& [tdc, ides] : parts[iPart].TDCIDEMap()) {
+      for (sim::IDE const& ide : ides) {
+        expectedMap[tdc].emplace_back(ide, offset);
+        if (iPart == 0) continue;
+        auto& range = expectedRanges[iPart - 1];
+        range.first = std::min(range.first, std::abs(ide.trackID) + offset);
+        range.second = std::max(range.second, std::abs(ide.trackID) + offset);
+      }
+    }
+  } // for parts
+  sim::SimChannel::TDCIDEs_t expectedTDCs;
+  for (auto& [tdc, ides] : expectedMap)
+    expectedTDCs.emplace_back(tdc, std::move(ides));
+  sim::SimChannel const expected{channel, std::move(expectedTDCs)};
+
+  // one at a time
+  sim::SimChannel merged = parts[0];
+  CheckSameRange(merged.MergeSimChannel(parts[1], offsets[0]), expectedRanges[0]);
+  CheckSameRange(merged.MergeSimChannel(parts[2], offsets[1]), expectedRanges[1]);
+  CheckSameSimChannel(merged, expected);
+
+  // all at once
+  sim::SimChannel mergedAll = parts[0];
+  std::array<sim::SimChannel const*, 2U> const others{&parts[1], &parts[2]};
+  auto const ranges = mergedAll.MergeSimChannels(others, offsets);
+  BOOST_TEST_REQUIRE(ranges.size() == 2U);
+  CheckSameRange(ranges[0], expectedRanges[0]);
+  CheckSameRange(ranges[1], expectedRanges[1]);
+  CheckSameSimChannel(mergedAll, expected);
+
+  // merging an empty channel
+  sim::SimChannel mergedEmpty = parts[0];
+  auto const emptyRange = mergedEmpty.MergeSimChannel(sim::SimChannel{channel}, 10);
+  BOOST_TEST(emptyRange.first == std::numeric_limits<int>::max());
+  BOOST_TEST(emptyRange.second == std::numeric_limits<int>::min());
+  CheckSameSimChannel(mergedEmpty, parts[0]);
+
+  sim::SimChannel wrong{channel};
+  BOOST_CHECK_THROW(wrong.MergeSimChannel(sim::SimChannel{channel + 1}, 0), std::runtime_error);
+  BOOST_CHECK_THROW(wrong.MergeSimChannels(others, {}), std::runtime_error);
+
+} // SimChannelMergeTest()
+
+void SimChannelOverlayTest()
+{
+  // three inputs, sorted by channel, sharing some of the channels
+  std::vector<sim::SimChannel> const inputA{MakePartialTestSimChannel(10, 0),
+                                            MakePartialTestSimChannel(12, 1)};
+  std::vector<sim::SimChannel> const inputB{MakePartialTestSimChannel(11, 2),
+                                            MakePartialTestSimChannel(12, 2),
+                                            MakePartialTestSimChannel(15, 0)};
+  std::vector<sim::SimChannel> const inputC; // empty
+  std::array<std::vector<sim::SimChannel> const*, 3U> const inputs{&inputA, &inputB, &inputC};
+  std::array<int, 3U> const offsets{0, 1000, 2000};
+
+  sim::OverlaidSimChannels_t const overlay = sim::OverlaySimChannels(inputs, offsets);
+
+  // expected: channel by channel merge
+  std::array<std::pair<int, int>, 3U> expectedRanges;
+  expectedRanges.fill({std::numeric_limits<int>::max(), std::numeric_limits<int>::min()});
+  auto const mergeInto = [&expectedRanges, &offsets](sim::SimChannel& channel,
+                                                     sim::SimChannel const& other,
+                                                     std::size_t iInput) {
+    auto const range = channel.MergeSimChannel(other, offsets[iInput]);
+    expectedRanges[iInput].first = std::min(expectedRanges[iInput].first, range.first);
+    expectedRanges[iInput].second = std::max(expectedRanges[iInput].second, range.second);
+  };
+  std::vector<sim::SimChannel> expected{
+    sim::SimChannel{10}, sim::SimChannel{11}, sim::SimChannel{12}, sim::SimChannel{15}};
+  mergeInto(expected[0], inputA[0], 0);
+  mergeInto(expected[1], inputB[0], 1);
+  mergeInto(expected[2], inputA[1], 0);
+  mergeInto(expected[2], inputB[1], 1);
+  mergeInto(expected[3], inputB[2], 1);
+
+  BOOST_TEST_REQUIRE(overlay.channels.size() == expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    CheckSameSimChannel(overlay.channels[i], expected[i]);
+  BOOST_TEST_REQUIRE(overlay.trackIDranges.size() == inputs.size());
+  for (std::size_t i = 0; i < inputs.size(); ++i)
+    CheckSameRange(overlay.trackIDranges[i], expectedRanges[i]);
+
+  // enough channels to be merged by many threads: same result as with one
+  std::vector<sim::SimChannel> largeA, largeB;
+  for (raw::ChannelID_t channel = 0; channel < 300; ++channel) {
+    if (channel % 4 != 3) largeA.push_back(MakePartialTestSimChannel(channel, channel % 3));
+    if (channel % 3 != 0) largeB.push_back(MakePartialTestSimChannel(channel, 2 - channel % 3));
+  }
+  std::array<std::vector<sim::SimChannel> const*, 2U> const largeInputs{&largeA, &largeB};
+  auto const largeOffsets = std::span(offsets).first(2);
+  sim::OverlaidSimChannels_t const serial =
+    sim::OverlaySimChannels(largeInputs, largeOffsets, 1);
+  for (unsigned int const nThreads : {3U, 8U, 0U}) {
+    BOOST_TEST_CONTEXT("threads: " << nThreads)
+    {
+      sim::OverlaidSimChannels_t const parallel =
+        sim::OverlaySimChannels(largeInputs, largeOffsets, nThreads);
+      BOOST_TEST_REQUIRE(parallel.channels.size() == serial.channels.size());
+      for (std::size_t i = 0; i < serial.channels.size(); ++i)
+        CheckSameSimChannel(parallel.channels[i], serial.channels[i]);
+      BOOST_TEST_REQUIRE(parallel.trackIDranges.size() == largeInputs.size());
+      for (std::size_t i = 0; i < largeInputs.size(); ++i)
+        CheckSameRange(parallel.trackIDranges[i], serial.trackIDranges[i]);
+    }
+  }
+
+  std::vector<sim::SimChannel> const unsorted{sim::SimChannel{5}, sim::SimChannel{3}};
+  std::array<std::vector<sim::SimChannel> const*, 1U> const unsortedInputs{&unsorted};
+  BOOST_CHECK_THROW(sim::OverlaySimChannels(unsortedInputs, std::span(offsets).first(1)),
+                    std::runtime_error);
+  BOOST_CHECK_THROW(sim::OverlaySimChannels(inputs, {}), std::runtime_error);
+
+} // SimChannelOverlayTest()
+
+void SimChannelTrackIndexTest(sim::SimChannelTrackIndex::TrackKey_t key,
+                              unsigned int nChannels,
+                              unsigned int nThreads)
+{
+  using TrackKey_t = sim::SimChannelTrackIndex::TrackKey_t;
+
+  std::vector<sim::SimChannel> channels{MakePartialTestSimChannel(10, 0),
+                                        sim::SimChannel{11},
+                                        MakePartialTestSimChannel(12, 1),
+                                        MakePartialTestSimChannel(13, 2)};
+  for (raw::ChannelID_t channel = 14; channels.size() < nChannels; ++channel)
+    channels.push_back(MakePartialTestSimChannel(channel, channel % 3));
+
+  sim::SimChannelTrackIndex const index{channels, key, nThreads};
+  BOOST_TEST((index.Key() == key));
+
+  // brute force: scan all deposits for each track
+  std::map<sim::SimChannel::TrackID_t, std::vector<sim::SimChannelTrackIndex::Deposit_t>> expected;
+  for (unsigned int iChannel = 0; iChannel < channels.size(); ++iChannel) {
+    for (auto const& [tdc, ides] : channels[iChannel].TDCIDEMap()) {
+      for (unsigned int iIDE = 0; iIDE < ides.size(); ++iIDE) {
+        sim::IDE const& ide = ides[iIDE];
+        int const trackID = (key == TrackKey_t::TrackID) ? ide.trackID : ide.origTrackID;
+        expected[trackID].push_back({iChannel, tdc, iIDE, ide.numElectrons});
+      }
+    }
+  }
+
+  BOOST_TEST(index.NTracks() == expected.size());
+  std::size_t nDeposits = 0;
+  for (auto const& [trackID, deposits] : expected) {
+    BOOST_TEST_CONTEXT("track ID=" << trackID)
+    {
+      BOOST_TEST(index.HasTrack(trackID));
+      auto const indexed = index.Deposits(trackID);
+      BOOST_TEST_REQUIRE(indexed.size() == deposits.size());
+      for (std::size_t i = 0; i < deposits.size(); ++i) {
+        BOOST_TEST(indexed[i].channel == deposits[i].channel);
+        BOOST_TEST(indexed[i].tdc == deposits[i].tdc);
+        BOOST_TEST(indexed[i].ide == deposits[i].ide);
+        BOOST_TEST(indexed[i].numElectrons == deposits[i].numElectrons);
+      }
+    }
+    nDeposits += deposits.size();
+  }
+  BOOST_TEST(index.NDeposits() == nDeposits);
+  BOOST_TEST(!index.HasTrack(1000000));
+
+  sim::SimChannelTrackIndex const empty;
+  BOOST_TEST(empty.NTracks() == 0U);
+  BOOST_TEST(empty.Deposits(1).empty());
+
+} // SimChannelTrackIndexTest()
+
+void SimChannelTrackIndexManyTracksTest()
+{
+  // one track per channel: fewer chunks than threads are used
+  std::vector<sim::SimChannel> channels;
+  double const xyz[3] = {0.0, 0.0, 0.0};
+  for (raw::ChannelID_t channel = 0; channel < 500; ++channel) {
+    channels.emplace_back(channel);
+    channels.back().AddIonizationElectrons(channel + 1, 10 + channel % 7, 100.0, xyz, 0.5);
+  }
+
+  using TrackKey_t = sim::SimChannelTrackIndex::TrackKey_t;
+  sim::SimChannelTrackIndex const index{channels, TrackKey_t::TrackID, 4};
+  BOOST_TEST(index.NTracks() == channels.size());
+  BOOST_TEST(index.NDeposits() == channels.size());
+  for (unsigned int iChannel = 0; iChannel < channels.size(); ++iChannel) {
+    auto const deposits = index.Deposits(iChannel + 1);
+    BOOST_TEST_REQUIRE(deposits.size() == 1U);
+    BOOST_TEST(deposits[0].channel == iChannel);
+    BOOST_TEST(deposits[0].tdc == 10 + iChannel % 7);
+    BOOST_TEST(deposits[0].ide == 0U);
+  }
+
+} // SimChannelTrackIndexManyTracksTest()
+
+void CompactSimChannelTest()
+{
+  sim::SimChannel const simChannel = MakeTestSimChannel(1234);
+  sim::CompactSimChannel const compact{simChannel};
+
+  BOOST_TEST(compact.Channel() == simChannel.Channel());
+  BOOST_TEST_REQUIRE(compact.NTDCs() == simChannel.TDCIDEMap().size());
+
+  std::size_t iTDC = 0;
+  for (auto const& [tdc, ides] : compact.TDCIDEMap()) {
+    auto const& [expectedTDC, expectedIDEs] = simChannel.TDCIDEMap()[iTDC++];
+    BOOST_TEST(tdc == expectedTDC);
+    CheckSameIDEs({ides.begin(), ides.end()}, expectedIDEs);
+  }
+  BOOST_TEST(iTDC == compact.NTDCs());
+
+  for (sim::SimChannel::TDC_t tdc = 0; tdc < 220; ++tdc) {
+    BOOST_TEST(compact.Charge(tdc) == simChannel.Charge(tdc));
+    BOOST_TEST(compact.Energy(tdc) == simChannel.Energy(tdc));
+  }
+
+  for (auto const& [start, end] : {std::pair{0U, 300U},
+                                   std::pair{10U, 10U},
+                                   std::pair{25U, 90U},
+                                   std::pair{200U, 250U},
+                                   std::pair{300U, 400U},
+                                   std::pair{50U, 40U}}) {
+    BOOST_TEST_CONTEXT("TDC window [ " << start << " ; " << end << " ]")
+    {
+      CheckSameIDEs(compact.TrackIDsAndEnergies(start, end),
+                    simChannel.TrackIDsAndEnergies(start, end));
+      CheckSameTrackIDEs(compact.TrackIDEs(start, end), simChannel.TrackIDEs(start, end));
+      std::vector<sim::IDE> ides;
+      compact.TrackIDsAndEnergies(start, end, ides);
+      CheckSameIDEs(ides, simChannel.TrackIDsAndEnergies(start, end));
+    }
+  }
+
+  CheckSameSimChannel(compact.MakeSimChannel(), simChannel);
+
+  sim::CompactSimChannel const empty;
+  BOOST_TEST(empty.NTDCs() == 0U);
+  BOOST_TEST(empty.TDCIDEMap().empty());
+  BOOST_TEST(empty.Charge(10) == 0.0);
+  BOOST_TEST(empty.TrackIDsAndEnergies(0, 100).empty());
+
+} // CompactSimChannelTest()
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(SimChannelBuilderTestCase)
+{
+  SimChannelBuilderTest();
+}
+
+BOOST_AUTO_TEST_CASE(SimChannelTrackIDsAndEnergiesTestCase)
+{
+  SimChannelTrackIDsAndEnergiesTest();
+}
+
+BOOST_AUTO_TEST_CASE(SimChannelTrackIDEsBatchTestCase)
+{
+  SimChannelTrackIDEsBatchTest();
+}
+
+BOOST_AUTO_TEST_CASE(SimChannelRangeSumsTestCase)
+{
+  SimChannelRangeSumsTest();
+}
+
+BOOST_AUTO_TEST_CASE(SimChannelMergeTestCase)
+{
+  SimChannelMergeTest();
+}
+
+BOOST_AUTO_TEST_CASE(SimChannelOverlayTestCase)
+{
+  SimChannelOverlayTest();
+}
+
+BOOST_AUTO_TEST_CASE(SimChannelTrackIndexTestCase)
+{
+  SimChannelTrackIndexTest(sim::SimChannelTrackIndex::TrackKey_t::TrackID, 4, 1);
+  SimChannelTrackIndexTest(sim::SimChannelTrackIndex::TrackKey_t::OrigTrackID, 4, 1);
+  // enough channels to be split among threads
+  SimChannelTrackIndexTest(sim::SimChannelTrackIndex::TrackKey_t::TrackID, 300, 4);
+  SimChannelTrackIndexTest(sim::SimChannelTrackIndex::TrackKey_t::OrigTrackID, 300, 0);
+  SimChannelTrackIndexManyTracksTest();
+}
+
+BOOST_AUTO_TEST_CASE(CompactSimChannelTestCase)
+{
+  CompactSimChannelTest();
+}
@@ -0,0 +1,120 @@
+/**
+ * @file    SimPhotons_test.cc
+ * @brief   Tests the photon counts of `sim::SimPhotonsLite`.
+ * @see     lardataobj/Simulation/SimPhotons.h
+ * @see     lardataobj/Simulation/CompactSimPhotonsLite.h
+ */
+
+// C/C++ standard library
+#include <cstddef> // std::size_t
+#include <map>
+
+// Boost libraries
+#define BOOST_TEST_MODULE (simphotons_test)
+#include "boost/test/unit_test.hpp"
+
+// LArSoft libraries
+#include "lardataobj/Simulation/CompactSimPhotonsLite.h"
+#include "lardataobj/Simulation/SimPhotons.h"
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+/// Creates photons on the specified channel, with `part` shifting their times.
+sim::SimPhotonsLite MakeTestSimPhotonsLite(int channel, int part)
+{
+  sim::SimPhotonsLite photons{channel};
+  for (int i = 0; i < 500; ++i) {
+    int const time = ((i * 7919) % 1201) - 100 + part * 37;
+    photons.DetectedPhotons[time] += (i % 23 == 0) ? 0 : 1 + (i + part) % 5;
+  }
+  return photons;
+} // MakeTestSimPhotonsLite()
+
+/// Checks that the compact photons have exactly the content of `expected`.
+void CheckSamePhotons(sim::CompactSimPhotonsLite const& photons,
+                      sim::SimPhotonsLite const& expected)
+{
+  BOOST_TEST(photons.OpChannel() == expected.OpChannel);
+  BOOST_TEST_REQUIRE(photons.NTicks() == expected.DetectedPhotons.size());
+  BOOST_TEST(photons.Photons().size() == photons.NTicks());
+  std::size_t i = 0;
+  for (auto const& [time, nPhotons] : expected.DetectedPhotons) {
+    BOOST_TEST(photons.Times()[i] == time);
+    BOOST_TEST(photons.Photons()[i] == nPhotons);
+    ++i;
+  }
+} // CheckSamePhotons()
+
+//------------------------------------------------------------------------------
+void CompactSimPhotonsLiteTest()
+{
+  sim::SimPhotonsLite const photons = MakeTestSimPhotonsLite(7, 0);
+  sim::CompactSimPhotonsLite const compact{photons};
+  CheckSamePhotons(compact, photons);
+  BOOST_TEST(!compact.empty());
+  BOOST_TEST((compact == sim::CompactSimPhotonsLite{7}));
+
+  // back to the map form
+  sim::SimPhotonsLite const back = compact.MakeSimPhotonsLite();
+  BOOST_TEST(back.OpChannel == photons.OpChannel);
+  BOOST_TEST((back.DetectedPhotons == photons.DetectedPhotons));
+
+  // queries
+  int total = 0;
+  for (auto const& [time, nPhotons] : photons.DetectedPhotons)
+    total += nPhotons;
+  BOOST_TEST(compact.TotalPhotons() == total);
+
+  for (int time = -120; time < 1150; time += 3) {
+    auto const itPhotons = photons.DetectedPhotons.find(time);
+    int const expected = (itPhotons == photons.DetectedPhotons.end()) ? 0 : itPhotons->second;
+    BOOST_TEST(compact.Photons(time) == expected);
+  }
+
+  for (int start = -120; start < 1150; start += 17) {
+    for (int const length : {0, 1, 10, 100, 2000}) {
+      int expected = 0;
+      for (auto const& [time, nPhotons] : photons.DetectedPhotons)
+        if ((time >= start) && (time <= start + length)) expected += nPhotons;
+      BOOST_TEST(compact.PhotonsInRange(start, start + length) == expected);
+    }
+  }
+  BOOST_TEST(compact.PhotonsInRange(10, 5) == 0);
+
+  // sum, compared to the one of the map form
+  for (int const part : {0, 1, 2}) {
+    BOOST_TEST_CONTEXT("part: " << part)
+    {
+      sim::SimPhotonsLite const other = MakeTestSimPhotonsLite(7, part);
+      sim::SimPhotonsLite expected = photons;
+      expected += other;
+
+      sim::CompactSimPhotonsLite sum = compact;
+      sum += sim::CompactSimPhotonsLite{other};
+      CheckSamePhotons(sum, expected);
+      CheckSamePhotons(compact + sim::CompactSimPhotonsLite{other}, expected);
+    }
+  }
+
+  // empty objects
+  sim::CompactSimPhotonsLite sum{7};
+  BOOST_TEST(sum.empty());
+  BOOST_TEST(sum.TotalPhotons() == 0);
+  BOOST_TEST(sum.PhotonsInRange(0, 100) == 0);
+  sum += compact;
+  CheckSamePhotons(sum, photons);
+  sum += sim::CompactSimPhotonsLite{7};
+  CheckSamePhotons(sum, photons);
+
+} // CompactSimPhotonsLiteTest()
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(CompactSimPhotonsLiteTestCase)
+{
+  CompactSimPhotonsLiteTest();
+}
@@ -397,6 +397,35 @@ void TestLazyVector_sizeConstructed()
 
 } // TestLazyVector_sizeConstructed()
 
+//------------------------------------------------------------------------------
+void TestLazyVector_memoryUsage()
+{
+
+  using Vector_t = util::LazyVector<double>;
+  Vector_t v(100);
+
+  auto usage = v.memory_usage();
+  BOOST_TEST(usage.n_ranges == 0U);
+  BOOST_TEST(usage.payload == 0U);
+  BOOST_TEST(usage.overhead == sizeof(v));
+  BOOST_TEST(usage.total() == usage.payload + usage.slack + usage.overhead);
+
+  v.reserve(50);
+  v[20] = 2.0;
+  v[29] = 9.0;
+  usage = v.memory_usage();
+  BOOST_TEST(usage.n_ranges == 1U);
+  BOOST_TEST(usage.payload == 10U * sizeof(double));
+  BOOST_TEST(usage.slack >= 40U * sizeof(double));
+
+  v.shrink_to_fit();
+  auto const shrunk = v.memory_usage();
+  BOOST_TEST(shrunk.n_ranges == 1U);
+  BOOST_TEST(shrunk.payload == usage.payload);
+  BOOST_TEST(shrunk.total() <= usage.total());
+
+} // TestLazyVector_memoryUsage()
+
 //------------------------------------------------------------------------------
 void TestLazyVector_documentation_class()
 {
@@ -496,6 +525,7 @@ BOOST_AUTO_TEST_CASE(LazyVectorTestCase)
   //
   TestLazyVector_defaultConstructed();
   TestLazyVector_sizeConstructed();
+  TestLazyVector_memoryUsage();
 
   //
   // documentation tests
@@ -0,0 +1,77 @@
+/**
+ * @file    ParallelChunks_test.cc
+ * @brief   Tests the chunked parallel processing utilities.
+ * @see     lardataobj/Utilities/ParallelChunks.h
+ */
+
+// LArSoft libraries
+#include "lardataobj/Utilities/ParallelChunks.h"
+
+#define BOOST_TEST_MODULE (ParallelChunks_test)
+#include "boost/test/unit_test.hpp"
+
+// C/C++ standard libraries
+#include <cstddef>   // std::size_t
+#include <stdexcept> // std::runtime_error
+#include <string>    // std::to_string()
+#include <vector>
+
+//------------------------------------------------------------------------------
+void ChunkBoundariesTest()
+{
+  BOOST_TEST(util::ResolveThreads(3) == 3U);
+  BOOST_TEST(util::ResolveThreads(0) >= 1U);
+
+  std::vector<std::size_t> const expected{0, 4, 7, 10};
+  BOOST_TEST(util::ChunkBoundaries(10, 3) == expected, boost::test_tools::per_element());
+
+  // chunks not smaller than the minimum size
+  std::vector<std::size_t> const expectedMin{0, 5, 10};
+  BOOST_TEST(util::ChunkBoundaries(10, 8, 4) == expectedMin, boost::test_tools::per_element());
+
+  // always at least one chunk
+  std::vector<std::size_t> const expectedOne{0, 3};
+  BOOST_TEST(util::ChunkBoundaries(3, 8, 10) == expectedOne, boost::test_tools::per_element());
+  std::vector<std::size_t> const expectedEmpty{0, 0};
+  BOOST_TEST(util::ChunkBoundaries(0, 4) == expectedEmpty, boost::test_tools::per_element());
+
+} // ChunkBoundariesTest()
+
+//------------------------------------------------------------------------------
+void ForEachChunkTest()
+{
+  std::vector<int> values(1000, 0);
+  std::vector<std::size_t> const bounds = util::ChunkBoundaries(values.size(), 4);
+  std::vector<std::size_t> chunkOf(values.size(), 99);
+  util::ForEachChunk(bounds, [&](std::size_t iChunk, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      ++values[i];
+      chunkOf[i] = iChunk;
+    }
+  });
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    BOOST_TEST(values[i] == 1);
+    BOOST_TEST(chunkOf[i] == i / 250);
+  }
+
+  // the exception of the first failing chunk is rethrown
+  BOOST_CHECK_EXCEPTION(
+    util::ForEachChunk(bounds,
+                       [](std::size_t iChunk, std::size_t, std::size_t) {
+                         if (iChunk >= 2) throw std::runtime_error(std::to_string(iChunk));
+                       }),
+    std::runtime_error,
+    [](std::runtime_error const& e) { return std::string(e.what()) == "2"; });
+
+} // ForEachChunkTest()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ChunkBoundariesTestCase)
+{
+  ChunkBoundariesTest();
+}
+
+BOOST_AUTO_TEST_CASE(ForEachChunkTestCase)
+{
+  ForEachChunkTest();
+}
@@ -0,0 +1,112 @@
+/**
+ * @file    compact_float_test.cc
+ * @brief   Tests the 16-bit representations of `float` values.
+ * @see     lardataobj/Utilities/compact_float.h
+ */
+
+// LArSoft libraries
+#include "lardataobj/Utilities/compact_float.h"
+
+#define BOOST_TEST_MODULE (compact_float_test)
+#include "boost/test/unit_test.hpp"
+
+// C/C++ standard libraries
+#include <cmath>   // std::isnan(), std::isinf(), std::abs()
+#include <cstdint> // std::uint16_t, std::int16_t
+#include <limits>
+#include <vector>
+
+//------------------------------------------------------------------------------
+void TestHalf()
+{
+  using namespace lar::compact;
+
+  // exactly representable values
+  BOOST_TEST(float_to_half(0.0f) == 0x0000U);
+  BOOST_TEST(float_to_half(-0.0f) == 0x8000U);
+  BOOST_TEST(float_to_half(1.0f) == 0x3C00U);
+  BOOST_TEST(float_to_half(-2.0f) == 0xC000U);
+  BOOST_TEST(float_to_half(65504.0f) == 0x7BFFU);
+  BOOST_TEST(float_to_half(std::ldexp(1.0f, -24)) == 0x0001U); // smallest subnormal
+
+  // rounding to nearest, ties to even
+  BOOST_TEST(float_to_half(1.0f + std::ldexp(1.0f, -11)) == 0x3C00U);
+  BOOST_TEST(float_to_half(1.0f + 3.0f * std::ldexp(1.0f, -11)) == 0x3C02U);
+
+  // special values
+  BOOST_TEST(float_to_half(1e6f) == 0x7C00U);
+  BOOST_TEST(float_to_half(-std::numeric_limits<float>::infinity()) == 0xFC00U);
+  BOOST_TEST(std::isnan(half_to_float(float_to_half(std::numeric_limits<float>::quiet_NaN()))));
+  BOOST_TEST(std::isinf(half_to_float(0x7C00U)));
+
+  // every non-NaN half value is converted back to itself
+  for (unsigned int bits = 0; bits < 0x10000U; ++bits) {
+    auto const half = static_cast<std::uint16_t>(bits);
+    if (((half & 0x7C00U) == 0x7C00U) && (half & 0x03FFU)) continue; // NaN
+    BOOST_TEST(float_to_half(half_to_float(half)) == half);
+  }
+
+} // TestHalf()
+
+//------------------------------------------------------------------------------
+void TestBFloat16()
+{
+  using namespace lar::compact;
+
+  BOOST_TEST(float_to_bfloat16(1.0f) == 0x3F80U);
+  BOOST_TEST(bfloat16_to_float(0x3F80U) == 1.0f);
+  BOOST_TEST(bfloat16_to_float(float_to_bfloat16(-3.0e30f)) == -3.0e30f,
+             boost::test_tools::tolerance(0.004f));
+  float const NaN = std::numeric_limits<float>::quiet_NaN();
+  BOOST_TEST(std::isnan(bfloat16_to_float(float_to_bfloat16(NaN))));
+
+  // rounding to nearest, ties to even
+  BOOST_TEST(float_to_bfloat16(1.0f + std::ldexp(1.0f, -8)) == 0x3F80U);
+  BOOST_TEST(float_to_bfloat16(1.0f + 3.0f * std::ldexp(1.0f, -8)) == 0x3F82U);
+
+} // TestBFloat16()
+
+//------------------------------------------------------------------------------
+void TestBulk()
+{
+  using namespace lar::compact;
+
+  std::vector<float> const values{0.0f, 1.5f, -2.25f, 100.0f, -0.001f, 37.7f};
+  std::vector<float> decoded(values.size());
+  std::vector<std::uint16_t> encoded(values.size());
+
+  encode_half(values, encoded);
+  decode_half(encoded, decoded);
+  for (std::size_t i = 0; i < values.size(); ++i)
+    BOOST_TEST(decoded[i] == values[i], boost::test_tools::tolerance(0.0005f));
+
+  encode_bfloat16(values, encoded);
+  decode_bfloat16(encoded, decoded);
+  for (std::size_t i = 0; i < values.size(); ++i)
+    BOOST_TEST(decoded[i] == values[i], boost::test_tools::tolerance(0.004f));
+
+  std::vector<std::int16_t> scaled(values.size());
+  float const scale = encode_scaled_int16(values, scaled);
+  BOOST_TEST(scale == 100.0f / 32767.0f);
+  BOOST_TEST(scaled[3] == 32767);
+  decode_scaled_int16(scaled, scale, decoded);
+  for (std::size_t i = 0; i < values.size(); ++i)
+    BOOST_TEST(std::abs(decoded[i] - values[i]) <= scale / 2.0f * 1.001f);
+
+  std::vector<float> const zeros(4, 0.0f);
+  BOOST_TEST(encode_scaled_int16(zeros, scaled) == 0.0f);
+  decode_scaled_int16({scaled.data(), zeros.size()}, 0.0f, decoded);
+  for (std::size_t i = 0; i < zeros.size(); ++i)
+    BOOST_TEST(decoded[i] == 0.0f);
+
+} // TestBulk()
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+
+BOOST_AUTO_TEST_CASE(CompactFloatTestCase)
+{
+  TestHalf();
+  TestBFloat16();
+  TestBulk();
+} // BOOST_AUTO_TEST_CASE(CompactFloatTestCase)
@@ -0,0 +1,145 @@
+/**
+ * @file    sparse_vector_packing_test.cc
+ * @brief   Tests the compact serialization of `lar::sparse_vector`.
+ * @see     lardataobj/Utilities/sparse_vector_packing.h
+ */
+
+// LArSoft libraries
+#include "lardataobj/Utilities/sparse_vector_packing.h"
+
+#define BOOST_TEST_MODULE (sparse_vector_packing_test)
+#include "boost/test/unit_test.hpp"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min()
+#include <cstdint>
+#include <stdexcept> // std::runtime_error
+#include <vector>
+
+//------------------------------------------------------------------------------
+template <typename T>
+void CheckSameContent(lar::sparse_vector<T> const& a, lar::sparse_vector<T> const& b)
+{
+  BOOST_TEST(a.size() == b.size());
+  BOOST_TEST(a.n_ranges() == b.n_ranges());
+  for (std::size_t i = 0; i < std::min(a.n_ranges(), b.n_ranges()); ++i) {
+    BOOST_TEST(a.range(i).begin_index() == b.range(i).begin_index());
+    BOOST_TEST(a.range(i).end_index() == b.range(i).end_index());
+  }
+  BOOST_TEST(std::vector<T>(a.begin(), a.end()) == std::vector<T>(b.begin(), b.end()),
+             boost::test_tools::per_element());
+} // CheckSameContent()
+
+//------------------------------------------------------------------------------
+void TestVarInt()
+{
+  std::vector<std::uint64_t> const values{
+    0U, 1U, 127U, 128U, 300U, 16383U, 16384U, 0xFFFFFFFFU, ~std::uint64_t(0)};
+
+  std::vector<unsigned char> buffer;
+  for (auto v : values)
+    lar::details::write_varint(buffer, v);
+
+  // small values take one byte, the largest one takes ten
+  BOOST_TEST(buffer.front() == 0U);
+  BOOST_TEST(buffer.size() == 1U + 1U + 1U + 2U + 2U + 2U + 3U + 5U + 10U);
+
+  std::size_t pos = 0;
+  for (auto v : values)
+    BOOST_TEST(lar::details::read_varint(buffer, pos) == v);
+  BOOST_TEST(pos == buffer.size());
+
+  // truncated value
+  std::vector<unsigned char> const truncated{0x80, 0x80};
+  pos = 0;
+  BOOST_CHECK_THROW(lar::details::read_varint(truncated, pos), std::runtime_error);
+
+  // too long value
+  std::vector<unsigned char> const overlong(11U, 0xFF);
+  pos = 0;
+  BOOST_CHECK_THROW(lar::details::read_varint(overlong, pos), std::runtime_error);
+
+} // TestVarInt()
+
+//------------------------------------------------------------------------------
+void TestRoundTrip()
+{
+  using Vector_t = lar::sparse_vector<float>;
+
+  // empty vector
+  Vector_t empty;
+  auto packed = lar::pack_sparse_vector(empty);
+  BOOST_TEST(packed.size == 0U);
+  BOOST_TEST(packed.borders.empty());
+  BOOST_TEST(packed.values.empty());
+  CheckSameContent(lar::unpack_sparse_vector(packed), empty);
+
+  // all void
+  Vector_t voids(100);
+  packed = lar::pack_sparse_vector(voids);
+  BOOST_TEST(packed.size == 100U);
+  BOOST_TEST(packed.borders.empty());
+  CheckSameContent(lar::unpack_sparse_vector(packed), voids);
+
+  // a few ranges, one at the very beginning, one at the very end
+  Vector_t sv(1000);
+  sv.add_range(0, std::vector<float>{1., 2., 3.});
+  sv.add_range(10, std::vector<float>{4.});
+  sv.add_range(300, std::vector<float>(150, 5.));
+  sv.add_range(995, std::vector<float>{6., 7., 8., 9., 10.});
+  packed = lar::pack_sparse_vector(sv);
+  BOOST_TEST(packed.size == 1000U);
+  BOOST_TEST(packed.values.size() == sv.count());
+  BOOST_TEST(packed.borders.size() == 2U * sv.n_ranges() + 3U); // 289, 545 and 150 take 2 bytes
+  CheckSameContent(lar::unpack_sparse_vector(packed), sv);
+
+  // trailing void cells
+  Vector_t padded(sv);
+  padded.resize(5000);
+  CheckSameContent(lar::unpack_sparse_vector(lar::pack_sparse_vector(padded)), padded);
+
+} // TestRoundTrip()
+
+//------------------------------------------------------------------------------
+void TestInvalid()
+{
+  lar::packed_sparse_vector<float> packed;
+  packed.size = 20;
+
+  // range with no data
+  packed.borders = {2, 3};
+  packed.values = {1., 2.};
+  BOOST_CHECK_THROW(lar::unpack_sparse_vector(packed), std::runtime_error);
+
+  // data not belonging to any range
+  packed.values = {1., 2., 3., 4.};
+  BOOST_CHECK_THROW(lar::unpack_sparse_vector(packed), std::runtime_error);
+
+  // empty range
+  packed.borders = {2, 0};
+  packed.values.clear();
+  BOOST_CHECK_THROW(lar::unpack_sparse_vector(packed), std::runtime_error);
+
+  // truncated borders
+  packed.borders = {2};
+  BOOST_CHECK_THROW(lar::unpack_sparse_vector(packed), std::runtime_error);
+
+  // and a valid one
+  packed.borders = {2, 3};
+  packed.values = {1., 2., 3.};
+  auto const sv = lar::unpack_sparse_vector(packed);
+  BOOST_TEST(sv.size() == 20U);
+  BOOST_TEST(sv.n_ranges() == 1U);
+  BOOST_TEST(sv[3] == 2.0F);
+
+} // TestInvalid()
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+
+BOOST_AUTO_TEST_CASE(SparseVectorPackingTestCase)
+{
+  TestVarInt();
+  TestRoundTrip();
+  TestInvalid();
+} // BOOST_AUTO_TEST_CASE(SparseVectorPackingTestCase)
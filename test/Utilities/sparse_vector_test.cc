@@ -17,7 +17,7 @@
 #include <algorithm>
 #include <iostream>
 #include <sstream>
-#include <stdexcept> // std::out_of_range
+#include <stdexcept> // std::out_of_range, std::logic_error, std::runtime_error
 #include <string>
 #include <utility> // std::make_pair()
 
@@ -591,6 +591,132 @@ namespace actions {
 
   }; // Assign<>
 
+  template <typename T>
+  class AssignFromDense : public BaseAction<T> {
+  public:
+    using Base_t = BaseAction<T>;
+    using typename Base_t::Data_t;
+    using typename Base_t::SparseVector_t;
+    using typename Base_t::TestClass_t;
+    using typename Base_t::Vector_t;
+
+    Vector_t data;
+    Data_t threshold;
+    size_t pre_padding, post_padding;
+
+    AssignFromDense(Vector_t new_data, Data_t thr, size_t pre = 0, size_t post = 0)
+      : data(new_data), threshold(thr), pre_padding(pre), post_padding(post)
+    {}
+
+  protected:
+    virtual void actionOnVector(Vector_t& v) const override
+    {
+      // keep a value if there is a value above threshold close enough to it
+      v.assign(data.size(), SparseVector_t::value_zero);
+      for (size_t i = 0; i < data.size(); ++i) {
+        if (SparseVector_t::is_zero(data[i], threshold)) continue;
+        size_t const first = (i > pre_padding) ? i - pre_padding : 0;
+        size_t const last = std::min(data.size(), i + post_padding + 1);
+        std::copy(data.begin() + first, data.begin() + last, v.begin() + first);
+      }
+    }
+    virtual void actionOnSparseVector(SparseVector_t& v) const override
+    {
+      v = SparseVector_t::from_dense(data, threshold, pre_padding, post_padding);
+    }
+
+    virtual void doDescribe(TestClass_t&, std::ostream& out) const override
+    {
+      out << "assign ";
+      PrintVector(data, out);
+      out << " above threshold " << threshold << " with padding " << pre_padding << " + "
+          << post_padding;
+    } // describe()
+
+  }; // AssignFromDense<>
+
+  template <typename T>
+  class AssignFromBuilder : public BaseAction<T> {
+  public:
+    using Base_t = BaseAction<T>;
+    using typename Base_t::Data_t;
+    using typename Base_t::SparseVector_t;
+    using typename Base_t::TestClass_t;
+    using typename Base_t::Vector_t;
+
+    std::vector<std::pair<size_t, Vector_t>> ranges; ///< sorted (offset, data)
+    size_t min_size;
+    size_t expected_ranges; ///< ranges in the result, after merging
+
+    AssignFromBuilder(std::vector<std::pair<size_t, Vector_t>> new_ranges,
+                      size_t size,
+                      size_t n_ranges)
+      : ranges(std::move(new_ranges)), min_size(size), expected_ranges(n_ranges)
+    {}
+
+  protected:
+    virtual void actionOnVector(Vector_t& v) const override
+    {
+      v.assign(min_size, SparseVector_t::value_zero);
+      for (auto const& [offset, data] : ranges) {
+        if (v.size() < offset + data.size()) v.resize(offset + data.size());
+        std::copy(data.begin(), data.end(), v.begin() + offset);
+      }
+    }
+    virtual void actionOnSparseVector(SparseVector_t& v) const override
+    {
+      lar::sparse_vector_builder<Data_t> builder;
+      builder.reserve(ranges.size());
+      bool useIterators = true;
+      for (auto const& [offset, data] : ranges) {
+        if (useIterators)
+          builder.add_range(offset, data.begin(), data.end());
+        else
+          builder.add_range(offset, Vector_t(data));
+        useIterators = !useIterators;
+        if (builder.end_index() != offset + data.size())
+          throw std::logic_error("sparse_vector_builder::end_index() is wrong");
+      }
+      if (builder.n_ranges() != expected_ranges)
+        throw std::logic_error("sparse_vector_builder did not merge adjacent ranges");
+
+      // overlapping and out-of-order ranges are rejected, and nothing is added
+      size_t const end = builder.end_index();
+      if (end > 0) {
+        Vector_t const data{Data_t(1)};
+        if (!throwsRuntimeError([&] { builder.add_range(end - 1, data.begin(), data.end()); }))
+          throw std::logic_error("sparse_vector_builder accepted an overlapping range");
+        if (!throwsRuntimeError([&] { builder.add_range(0, Vector_t(data)); }))
+          throw std::logic_error("sparse_vector_builder accepted a range out of order");
+        if ((builder.end_index() != end) || (builder.n_ranges() != expected_ranges))
+          throw std::logic_error("sparse_vector_builder changed after a rejected range");
+      }
+
+      v = builder.finalize(min_size);
+      if (builder.n_ranges() != 0)
+        throw std::logic_error("sparse_vector_builder::finalize() did not reset the builder");
+    }
+
+    virtual void doDescribe(TestClass_t&, std::ostream& out) const override
+    {
+      out << "build with " << ranges.size() << " ranges and size at least " << min_size;
+    } // describe()
+
+  private:
+    template <typename Op>
+    static bool throwsRuntimeError(Op op)
+    {
+      try {
+        op();
+      }
+      catch (std::runtime_error const&) {
+        return true;
+      }
+      return false;
+    }
+
+  }; // AssignFromBuilder<>
+
   template <typename T>
   class AssignMove : public BaseAction<T> {
   public:
@@ -703,6 +829,52 @@ namespace actions {
 
   }; // Add<>
 
+  template <typename T>
+  class Merge : public BaseAction<T> {
+  public:
+    using Base_t = BaseAction<T>;
+    using typename Base_t::Data_t;
+    using typename Base_t::SparseVector_t;
+    using typename Base_t::TestClass_t;
+    using typename Base_t::Vector_t;
+
+    std::vector<Vector_t> others;
+
+    Merge(std::vector<Vector_t> others) : others(others) {}
+
+  protected:
+    virtual void actionOnVector(Vector_t& v) const override
+    {
+      for (Vector_t const& other : others) {
+        v.resize(std::max(v.size(), other.size()), 0);
+        std::transform(other.cbegin(), other.cend(), v.cbegin(), v.begin(), std::plus<Data_t>());
+      }
+    }
+    virtual void actionOnSparseVector(SparseVector_t& v) const override
+    {
+      // the void of the other vectors is where they have zeroes
+      std::vector<SparseVector_t> sparseOthers;
+      for (Vector_t const& other : others)
+        sparseOthers.push_back(SparseVector_t::from_dense(other, 0));
+      if (sparseOthers.size() == 1) {
+        v += sparseOthers.front();
+        return;
+      }
+      std::vector<SparseVector_t const*> inputs{&v};
+      for (SparseVector_t const& other : sparseOthers)
+        inputs.push_back(&other);
+      v = SparseVector_t::merge(inputs, std::plus<Data_t>());
+    }
+
+    virtual void doDescribe(TestClass_t&, std::ostream& out) const override
+    {
+      out << "increment by data in";
+      for (Vector_t const& other : others)
+        PrintVector(other, out << " ");
+    } // describe()
+
+  }; // Merge<>
+
   template <typename T>
   class Erase : public BaseAction<T> {
   public:
@@ -850,6 +1022,49 @@ namespace actions {
   template <typename T>
   explicit ScaleAll(T factor)->ScaleAll<T>;
 
+  template <typename T>
+  class ScaleAllWithCursor : public BaseAction<T> {
+  public:
+    using Base_t = BaseAction<T>;
+    using typename Base_t::Data_t;
+    using typename Base_t::SparseVector_t;
+    using typename Base_t::TestClass_t;
+    using typename Base_t::Vector_t;
+
+    Data_t factor;
+    size_t stride;
+
+    ScaleAllWithCursor(Data_t factor, size_t stride = 1) : factor(factor), stride(stride) {}
+
+  protected:
+    virtual void actionOnVector(Vector_t& v) const override
+    {
+      for (auto& value : v)
+        value *= factor;
+    }
+    virtual void actionOnSparseVector(SparseVector_t& v) const override
+    {
+      // reads from a copy through the cursor, writes into the original;
+      // each pass starts behind the previous one, to exercise the backward seek
+      SparseVector_t const source(v);
+      auto cursor = source.cursor();
+      for (size_t start = 0; start < stride; ++start) {
+        for (size_t i = start; i < source.size(); i += stride) {
+          if (!cursor.is_void(i)) v[i] = cursor[i] * factor;
+        }
+      }
+    }
+
+    virtual void doDescribe(TestClass_t&, std::ostream& out) const override
+    {
+      out << "scale all data by a factor " << factor << " via cursor, with stride " << stride;
+    }
+
+  }; // ScaleAllWithCursor<>
+
+  template <typename T>
+  explicit ScaleAllWithCursor(T factor, size_t stride)->ScaleAllWithCursor<T>;
+
   template <typename T>
   class SetElement : public BaseAction<T> {
   public:
@@ -1027,6 +1242,41 @@ namespace actions {
 
   }; // Optimize<>
 
+  template <typename T>
+  class ShrinkToFit : public BaseAction<T> {
+  public:
+    using Base_t = BaseAction<T>;
+    using typename Base_t::Data_t;
+    using typename Base_t::SparseVector_t;
+    using typename Base_t::TestClass_t;
+    using typename Base_t::Vector_t;
+
+  protected:
+    virtual void actionOnSparseVector(SparseVector_t& v) const override
+    {
+      auto const before = v.memory_usage();
+      if (before.n_ranges != v.n_ranges())
+        throw std::logic_error("memory_usage() reports a wrong number of ranges");
+      if (before.payload != v.count() * sizeof(Data_t))
+        throw std::logic_error("memory_usage() reports a wrong payload");
+
+      v.shrink_to_fit();
+
+      auto const after = v.memory_usage();
+      if ((after.n_ranges != before.n_ranges) || (after.payload != before.payload) ||
+          (after.overhead != before.overhead))
+        throw std::logic_error("shrink_to_fit() changed the content");
+      if (after.total() > before.total())
+        throw std::logic_error("shrink_to_fit() increased memory usage");
+    }
+
+    virtual void doDescribe(TestClass_t&, std::ostream& out) const override
+    {
+      out << "shrink the memory of the sparse vector to fit";
+    }
+
+  }; // ShrinkToFit<>
+
   template <typename T>
   class FailTest : public BaseAction<T> {
   public:
@@ -1134,6 +1384,7 @@ int main()
 
   // first test: instanciate
   TestManagerClass<Data_t> Test;
+  using Vector_t = TestManagerClass<Data_t>::Vector_t;
 
   Test(actions::BaseAction<Data_t>());
 
@@ -1147,6 +1398,28 @@ int main()
 
   Test(actions::Clear<Data_t>());
 
+  Test(actions::AssignFromDense<Data_t>({0, 1, 3, 0, 0, 0, 0, 0, -4, 1, 0, 0, 0, 6}, 2));
+
+  Test(actions::AssignFromDense<Data_t>({0, 1, 3, 0, 0, 0, 0, 0, -4, 1, 0, 0, 0, 6}, 2, 1, 2));
+
+  Test(actions::AssignFromDense<Data_t>({0, 1, 3, 0, 0, 0, 0, 0, -4, 1, 0, 0, 0, 6}, 2, 3, 3));
+
+  Test(actions::AssignFromDense<Data_t>(Vector_t(40, 0.5), 1, 2, 2));
+
+  Vector_t dense(40, 0.5);
+  dense[3] = dense[17] = dense[18] = dense[38] = 5.0;
+  Test(actions::AssignFromDense<Data_t>(dense, 1, 2, 1));
+
+  Test(actions::AssignFromBuilder<Data_t>({{2, {2, 3}}, {6, {6}}, {9, {9, 10, 11}}}, 15, 3));
+
+  // adjacent ranges are merged
+  Test(actions::AssignFromBuilder<Data_t>(
+    {{0, {1, 2}}, {2, {3}}, {3, {4, 5}}, {8, {8}}, {9, {}}, {9, {9, 10}}}, 5, 2));
+
+  Test(actions::AssignFromBuilder<Data_t>({}, 7, 0));
+
+  Test(actions::Clear<Data_t>());
+
   Test(actions::Insert<Data_t>(5, {5, 6, 7}));
 
   Test(actions::Insert<Data_t>(15, {15, 16, 17}));
@@ -1210,6 +1483,10 @@ int main()
 
   Test(actions::ScaleAll(0.5F));
 
+  Test(actions::ScaleAllWithCursor(2.0F, 1));
+
+  Test(actions::ScaleAllWithCursor(0.5F, 3));
+
   Test(actions::UnsetElement<Data_t>(14));
 
   Test(actions::UnsetElement<Data_t>(15));
@@ -1220,10 +1497,16 @@ int main()
 
   Test(actions::UnsetElement<Data_t>(25));
 
+  Test(actions::ScaleAllWithCursor(4.0F, 5));
+
+  Test(actions::ScaleAllWithCursor(0.25F, 2));
+
   Test(actions::PrintNonVoid<Data_t>());
 
   Test(actions::Optimize<Data_t>(-1));
 
+  Test(actions::ShrinkToFit<Data_t>());
+
   // at this point:
   // (31) [2] {
   //      0     0    0 [  3    4    5    6 ]  0     0     0
@@ -1291,6 +1574,19 @@ int main()
   //      0
   //   }
 
+  Test(actions::Merge<Data_t>({{0, 1, 1, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3}}));
+
+  Test(actions::Merge<Data_t>({{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5}}));
+
+  Test(actions::Merge<Data_t>({{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+                               {0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+                               {}}));
+
+  Test(actions::Truncate<Data_t>(new_size));
+
   Test(actions::Truncate<Data_t>(new_size -= 3));
 
   Test(actions::Truncate<Data_t>(16));